@@ -1,9 +1,13 @@
 // C++ Standard Library
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <vector>
 
 // TwoD
 #include <twod/coordinates.h>
@@ -16,6 +20,7 @@
 #include <mmpl/state.h>
 #include <mmpl/state_space.h>
 #include <mmpl/termination_criteria.h>
+#include <mmpl/trace.h>
 #include <mmpl/planner_code_ostream.h>
 #include <mmpl/expansion_queue/min_sorted.h>
 #include <mmpl/expansion_table/unordered.h>
@@ -180,11 +185,13 @@ int main(int argc, char** argv)
   std::cout << "start : " << start << std::endl;
   std::cout << "goal  : " << goal << std::endl;
 
-  // Reconstruct planning path if goal is found
+  // Reconstruct planning path, in order from start to goal, if goal is found; parent links are walked once, from
+  // the goal back to the start
   std::vector<State2D> path;
   if (code == PlannerCode::GOAL_FOUND)
   {
     generate_reverse_path(std::back_inserter(path), goal, planner.expansion_table());
+    std::reverse(path.begin(), path.end());
   }
 
   // Log about the planned path
@@ -203,5 +210,12 @@ int main(int argc, char** argv)
     std::cout << std::endl;
   }
 
+#ifdef MMPL_ENABLE_TRACE
+  // Write per-phase timings; open with chrome://tracing or Perfetto
+  std::ofstream trace_file{"dijkstras_2d.trace.json"};
+  trace::write_chrome_trace(trace_file);
+  std::cout << "trace : dijkstras_2d.trace.json (" << trace::event_count() << " events)" << std::endl;
+#endif  // MMPL_ENABLE_TRACE
+
   return 0;
 }
@@ -0,0 +1,570 @@
+#ifndef MMPL_COST_TO_GO_H
+#define MMPL_COST_TO_GO_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/layout.h>
+#include <mmpl/metric.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner_code.h>
+#include <mmpl/state_space.h>
+#include <mmpl/termination_criteria.h>
+#include <mmpl/value.h>
+
+namespace mmpl
+{
+
+/**
+ * @brief Next-step storage which records the dense ID of each next state
+ *
+ *        Also keeps an intrusive list of the states whose next step is each state, so that the states behind any
+ *        state are enumerated without a scan. Works with any indexer; takes three IDs per state.
+ */
+template <typename IndexerT> class NextStepIndex
+{
+public:
+  /// Next-step ID of states without a record
+  static constexpr std::uint32_t UNSET = std::numeric_limits<std::uint32_t>::max();
+
+  explicit NextStepIndex(const IndexerT& indexer) :
+      next_(indexer.size(), UNSET),
+      first_child_(indexer.size(), UNSET),
+      next_sibling_(indexer.size(), UNSET)
+  {}
+
+  /**
+   * @brief Clears all records
+   */
+  inline void reset()
+  {
+    std::fill(next_.begin(), next_.end(), UNSET);
+    std::fill(first_child_.begin(), first_child_.end(), UNSET);
+  }
+
+  /**
+   * @brief Checks if state with dense ID <code>id</code> has a next step
+   */
+  inline bool is_set(const std::uint32_t id) const { return next_[id] != UNSET; }
+
+  /**
+   * @brief Returns dense ID of next state after state with dense ID <code>id</code>; <code>id</code> for the goal
+   */
+  inline std::uint32_t next(const std::uint32_t id) const { return next_[id]; }
+
+  /**
+   * @brief Sets next step of <code>state</code>, replacing any set before
+   */
+  template <typename StateT> inline void set(const StateT& state, const StateT& next)
+  {
+    const std::uint32_t id = state.id();
+    unset(id);
+    next_[id] = next.id();
+    if (next_[id] != id)
+    {
+      next_sibling_[id] = first_child_[next_[id]];
+      first_child_[next_[id]] = id;
+    }
+  }
+
+  /**
+   * @brief Clears next step of state with dense ID <code>id</code>
+   */
+  inline void unset(const std::uint32_t id)
+  {
+    if (next_[id] != UNSET and next_[id] != id)
+    {
+      std::uint32_t* link = std::addressof(first_child_[next_[id]]);
+      while (*link != id)
+      {
+        link = std::addressof(next_sibling_[*link]);
+      }
+      *link = next_sibling_[id];
+    }
+    next_[id] = UNSET;
+  }
+
+  /**
+   * @brief Calls <code>child_fn(child_id)</code> for each state whose next step is state with dense ID <code>id</code>
+   *
+   * @warn <code>child_fn</code> must not modify records
+   */
+  template <typename ChildFnT> inline void for_each_child(const std::uint32_t id, ChildFnT&& child_fn) const
+  {
+    for (std::uint32_t child = first_child_[id]; child != UNSET; child = next_sibling_[child])
+    {
+      child_fn(child);
+    }
+  }
+
+private:
+  /// Per-state dense ID of next state toward the goal
+  std::vector<std::uint32_t> next_;
+
+  /// Per-state dense ID of first state whose next step it is
+  std::vector<std::uint32_t> first_child_;
+
+  /// Per-state dense ID of following state with the same next step
+  std::vector<std::uint32_t> next_sibling_;
+};
+
+
+/**
+ * @brief Next-step storage which records a one-byte direction code per grid::Layout cell
+ *
+ *        Code <code>sum((delta[d] + 1) * 3^d)</code> encodes the step <code>delta</code> to a neighboring cell,
+ *        and the central code (zero step) marks the goal. The states behind a cell are the neighbors whose codes
+ *        point back at it, so they are enumerated without a separate index.
+ *
+ * @warn Expects next steps to be between cells at most one step apart along each dimension
+ */
+template <std::size_t Dim> class NextStepDirections
+{
+public:
+  /// Direction code of states without a record
+  static constexpr std::uint8_t UNSET = std::numeric_limits<std::uint8_t>::max();
+
+  explicit NextStepDirections(const grid::Layout<Dim>& layout) : codes_(layout.size(), UNSET)
+  {
+    for (std::size_t code = 0; code < CODE_COUNT; ++code)
+    {
+      grid::Coordinates<Dim> delta;
+      for (std::size_t d = 0, remainder = code; d < Dim; ++d, remainder /= 3)
+      {
+        delta[d] = static_cast<std::int32_t>(remainder % 3) - 1;
+      }
+      offsets_[code] = layout.offset(delta);
+    }
+  }
+
+  /**
+   * @brief Clears all records
+   */
+  inline void reset() { std::fill(codes_.begin(), codes_.end(), UNSET); }
+
+  /**
+   * @copydoc NextStepIndex::is_set
+   */
+  inline bool is_set(const std::uint32_t id) const { return codes_[id] != UNSET; }
+
+  /**
+   * @copydoc NextStepIndex::next
+   */
+  inline std::uint32_t next(const std::uint32_t id) const
+  {
+    return static_cast<std::uint32_t>(static_cast<std::int32_t>(id) + offsets_[codes_[id]]);
+  }
+
+  /**
+   * @copydoc NextStepIndex::set
+   */
+  inline void set(const grid::Cell<Dim>& state, const grid::Cell<Dim>& next)
+  {
+    std::size_t code = 0;
+    for (std::size_t d = Dim, scale = CODE_COUNT / 3; d > 0; --d, scale /= 3)
+    {
+      const std::int32_t delta = next[d - 1] - state[d - 1];
+      MMPL_RUNTIME_ASSERT(delta >= -1 and delta <= 1);
+      code += static_cast<std::size_t>(delta + 1) * scale;
+    }
+    codes_[state.index()] = static_cast<std::uint8_t>(code);
+  }
+
+  /**
+   * @copydoc NextStepIndex::unset
+   */
+  inline void unset(const std::uint32_t id) { codes_[id] = UNSET; }
+
+  /**
+   * @copydoc NextStepIndex::for_each_child
+   */
+  template <typename ChildFnT> inline void for_each_child(const std::uint32_t id, ChildFnT&& child_fn) const
+  {
+    for (std::size_t code = 0; code < CODE_COUNT; ++code)
+    {
+      // The cell at step code from this one points back with the mirrored code
+      const auto child = static_cast<std::uint32_t>(static_cast<std::int32_t>(id) + offsets_[code]);
+      if (code != CODE_COUNT / 2 and codes_[child] == CODE_COUNT - 1 - code)
+      {
+        child_fn(child);
+      }
+    }
+  }
+
+private:
+  /// Number of direction codes, including the central code
+  static constexpr std::size_t CODE_COUNT = [] {
+    std::size_t count = 1;
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      count *= 3;
+    }
+    return count;
+  }();
+
+  static_assert(CODE_COUNT <= UNSET, MMPL_STATIC_ASSERT_MSG("Direction codes must fit below UNSET"));
+
+  /// Per-cell direction code of step toward the goal
+  std::vector<std::uint8_t> codes_;
+
+  /// Linear index offset of each direction code
+  std::array<std::int32_t, CODE_COUNT> offsets_;
+};
+
+
+/**
+ * @brief Selects default next-step storage for states indexed by <code>IndexerT</code>
+ */
+template <typename IndexerT> struct NextStepStorage
+{
+  using type = NextStepIndex<IndexerT>;
+};
+
+
+template <std::size_t Dim> struct NextStepStorage<grid::Layout<Dim>>
+{
+  using type = NextStepDirections<Dim>;
+};
+
+
+template <typename IndexerT> using next_step_storage_t = typename NextStepStorage<IndexerT>::type;
+
+
+/**
+ * @brief Dense cost-to-go and next-step field over states with dense IDs
+ *
+ *        Used as the expansion table of a planner searching backward from a goal; once the search is done, the
+ *        parent of each state is its next step toward the goal and its total value is its cost-to-go. Any state's
+ *        path to the goal is then read in time linear in path length, without further search.
+ *
+ *        Buffers are sized once from the indexer and reused by <code>reset</code>, so the field can be rebuilt for
+ *        new goals without reallocation.
+ *
+ *        States with cost-to-go greater than the field radius are never recorded, and so are left unreachable.
+ *
+ *        <code>IndexerT</code> maps dense IDs back to states and must provide:
+ *        - <code>std::size_t size() const</code>, one past the largest state ID
+ *        - <code>StateT state(std::uint32_t id) const</code>
+ *
+ *        Next steps are kept by <code>NextStepT</code>; by default, direction codes for grid::Layout cells, and
+ *        dense IDs otherwise.
+ *
+ * @warn Referenced indexer must outlive this object
+ */
+template <typename StateT, typename ValueT, typename IndexerT, typename NextStepT = next_step_storage_t<IndexerT>>
+class CostToGoField : public ExpansionTableBase<CostToGoField<StateT, ValueT, IndexerT, NextStepT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param indexer  maps dense state IDs to states
+   */
+  explicit CostToGoField(const IndexerT& indexer) :
+      indexer_{std::addressof(indexer)},
+      values_(indexer.size(), Invalid<ValueT>::value),
+      next_{indexer}
+  {}
+
+  /**
+   * @brief Sets largest cost-to-go recorded by subsequent expansions
+   */
+  inline void set_radius(const ValueT& radius) { radius_ = radius; }
+
+  /**
+   * @brief Returns largest cost-to-go recorded by expansions
+   */
+  inline const ValueT& radius() const { return radius_; }
+
+  /**
+   * @brief Returns indexer mapping dense IDs to states
+   */
+  inline const IndexerT& indexer() const { return *indexer_; }
+
+  /**
+   * @brief Checks if a path to the goal is known from <code>query</code>
+   */
+  inline bool is_reachable(const StateT& query) const { return next_.is_set(query.id()); }
+
+  /**
+   * @brief Returns cost from <code>query</code> to the goal; Invalid value if not reachable
+   */
+  inline ValueT cost_to_go(const StateT& query) const { return values_[query.id()]; }
+
+  /**
+   * @brief Returns next state on the path from <code>query</code> to the goal
+   *
+   * @warn Expects the following precondition to be satisfied: <code>is_reachable(query) == true</code>
+   */
+  inline StateT next(const StateT& query) const
+  {
+    MMPL_RUNTIME_ASSERT(is_reachable(query));
+    return indexer_->state(next_.next(query.id()));
+  }
+
+  /**
+   * @brief Writes path from <code>start</code> to the goal, inclusive
+   *
+   * @param start  path start state
+   * @param output  output iterator receiving path states
+   *
+   * @return output iterator one past the last written state
+   *
+   * @warn Expects the following precondition to be satisfied: <code>is_reachable(start) == true</code>
+   */
+  template <typename OutputIteratorT> OutputIteratorT follow(const StateT& start, OutputIteratorT output) const
+  {
+    MMPL_RUNTIME_ASSERT(is_reachable(start));
+    std::uint32_t id = start.id();
+    *output++ = start;
+    for (std::uint32_t next = next_.next(id); next != id; next = next_.next(id))
+    {
+      id = next;
+      *output++ = indexer_->state(id);
+    }
+    return output;
+  }
+
+  /**
+   * @brief Invalidates records of changed states, and of all states whose path to the goal passes through them
+   *
+   *        Walks back from the changed states through the states whose next step they are, so takes time linear in
+   *        the number of invalidated states.
+   *
+   * @param first  iterator to first changed state
+   * @param last  iterator one past last changed state
+   *
+   * @return dense IDs of all invalidated states
+   */
+  template <typename StateIteratorT>
+  const std::vector<std::uint32_t>& invalidate(StateIteratorT first, StateIteratorT last)
+  {
+    invalidated_.clear();
+
+    for (; first != last; ++first)
+    {
+      pending_.push_back(first->id());
+    }
+
+    while (!pending_.empty())
+    {
+      const std::uint32_t id = pending_.back();
+      pending_.pop_back();
+
+      // Already invalidated through another changed state
+      if (!next_.is_set(id))
+      {
+        continue;
+      }
+
+      next_.for_each_child(id, [this](const std::uint32_t child) { pending_.push_back(child); });
+      next_.unset(id);
+      values_[id] = Invalid<ValueT>::value;
+      invalidated_.push_back(id);
+    }
+    return invalidated_;
+  }
+
+private:
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl()
+  {
+    std::fill(values_.begin(), values_.end(), Invalid<ValueT>::value);
+    next_.reset();
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    if (radius_ < total_value or is_reachable(child))
+    {
+      return false;
+    }
+    values_[child.id()] = total_value;
+    next_.set(child, parent);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    if (radius_ < total_value or (is_reachable(child) and !(total_value < values_[child.id()])))
+    {
+      return false;
+    }
+    values_[child.id()] = total_value;
+    next_.set(child, parent);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateT& query) const { return is_reachable(query); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_parent
+   */
+  inline StateT get_parent_impl(const StateT& query) const { return indexer_->state(next_.next(query.id())); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueT get_total_value_impl(const StateT& query) const { return values_[query.id()]; }
+
+  /// Maps dense IDs to states
+  const IndexerT* indexer_;
+
+  /// Largest recorded cost-to-go
+  ValueT radius_ = Invalid<ValueT>::value;
+
+  /// Per-state cost-to-go
+  std::vector<ValueT> values_;
+
+  /// Per-state next step toward the goal
+  NextStepT next_;
+
+  /// Invalidation work list scratch buffer
+  std::vector<std::uint32_t> pending_;
+
+  /// IDs of states invalidated by last call to invalidate
+  std::vector<std::uint32_t> invalidated_;
+
+  friend class ExpansionTableBase<CostToGoField<StateT, ValueT, IndexerT, NextStepT>>;
+};
+
+
+template <typename StateT, typename ValueT, typename IndexerT, typename NextStepT>
+struct ExpansionTableTraits<CostToGoField<StateT, ValueT, IndexerT, NextStepT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+
+/**
+ * @brief Builds a cost-to-go field by searching backward from <code>goal</code>
+ *
+ *        Clears and reuses the field held as the expansion table of <code>planner</code>. For directed state spaces,
+ *        <code>state_space</code> must enumerate predecessors and <code>metric(s, p)</code> must give the value of the
+ *        edge from <code>p</code> to <code>s</code>; for symmetric state spaces (e.g. grids) the forward state space
+ *        and metric may be used directly.
+ *
+ * @param planner  planner whose expansion table is a CostToGoField
+ * @param metric  edge value metric
+ * @param state_space  (reverse) state space
+ * @param goal  goal state
+ * @param radius  states with cost-to-go greater than this are left unreached
+ *
+ * @return pair of (planner code, iterations); code is INFEASIBLE once every state within <code>radius</code> was
+ *         reached
+ */
+template <typename PlannerT, typename MetricT, typename StateSpaceT>
+inline std::pair<PlannerCode, std::size_t> build_cost_to_go(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  StateSpaceBase<StateSpaceT>& state_space,
+  const planner_state_t<PlannerT>& goal,
+  const planner_value_t<PlannerT>& radius = Invalid<planner_value_t<PlannerT>>::value)
+{
+  planner.reset();
+  planner.expansion_table().set_radius(radius);
+  planner.enqueue(goal);
+
+  CostRadiusTerminationCriteria<planner_state_t<PlannerT>, planner_value_t<PlannerT>> criteria{radius};
+
+  PlannerCode code;
+  std::size_t iterations{0};
+  while (code == PlannerCode::SEARCHING)
+  {
+    ++iterations;
+    code = planner.update(metric, state_space, criteria);
+  }
+  return std::make_pair(code, iterations);
+}
+
+
+/**
+ * @brief Incrementally repairs a cost-to-go field after a set of states changed
+ *
+ *        Only states whose path to the goal passed through a changed state are recomputed. The search is resumed
+ *        from still-valid neighbors of invalidated and changed states, which also propagates any cost decreases
+ *        (e.g. from newly freed states).
+ *
+ * @param planner  planner whose expansion table is a CostToGoField built with <code>build_cost_to_go</code>
+ * @param metric  edge value metric
+ * @param state_space  (reverse) state space reflecting the change
+ * @param first  iterator to first changed state
+ * @param last  iterator one past last changed state
+ * @param radius  states with cost-to-go greater than this are left unreached
+ *
+ * @return pair of (planner code, iterations); code is INFEASIBLE once every state within <code>radius</code> was
+ *         reached
+ */
+template <typename PlannerT, typename MetricT, typename StateSpaceT, typename StateIteratorT>
+inline std::pair<PlannerCode, std::size_t> repair_cost_to_go(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  StateSpaceBase<StateSpaceT>& state_space,
+  StateIteratorT first,
+  StateIteratorT last,
+  const planner_value_t<PlannerT>& radius = Invalid<planner_value_t<PlannerT>>::value)
+{
+  using StateType = planner_state_t<PlannerT>;
+
+  auto& field = planner.expansion_table();
+  const auto& indexer = field.indexer();
+
+  planner.expansion_queue().reset();
+  field.set_radius(radius);
+
+  // Resumes search from valid neighbors of a state
+  const auto requeue_neighbors = [&planner, &state_space, &field](const StateType& state) {
+    state_space.for_each_child(state, [&planner, &field](const StateType& child) {
+      if (field.is_reachable(child))
+      {
+        planner.requeue(child);
+      }
+    });
+  };
+
+  for (const std::uint32_t id : field.invalidate(first, last))
+  {
+    requeue_neighbors(indexer.state(id));
+  }
+  for (; first != last; ++first)
+  {
+    requeue_neighbors(*first);
+  }
+
+  CostRadiusTerminationCriteria<StateType, planner_value_t<PlannerT>> criteria{radius};
+
+  PlannerCode code;
+  std::size_t iterations{0};
+  while (code == PlannerCode::SEARCHING)
+  {
+    ++iterations;
+    code = planner.update(metric, state_space, criteria);
+  }
+  return std::make_pair(code, iterations);
+}
+
+}  // namespace mmpl
+
+#endif  // MMPL_COST_TO_GO_H
@@ -0,0 +1,280 @@
+#ifndef MMPL_EDGE_CACHE_H
+#define MMPL_EDGE_CACHE_H
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// MMPL
+#include <mmpl/support.h>
+
+namespace mmpl
+{
+
+/**
+ * @brief Bounded, thread-safe cache of edge validity and edge values, keyed by (parent ID, child ID)
+ *
+ *        Entries live in a fixed-capacity, 4-way set-associative table: each edge hashes to a bucket of four slots,
+ *        and an edge inserted into a full bucket evicts one of them, so memory use never grows past the initial
+ *        capacity. Buckets are guarded by a fixed number of striped locks, so concurrent threads rarely contend.
+ *
+ *        Every entry is stamped with the cache version current when it was written. <code>invalidate</code> bumps
+ *        the version, which discards all entries at once (e.g. after the environment changed) without touching the
+ *        table.
+ *
+ *        Writers read <code>version</code> before computing a result, and pass it along with the result, so a result
+ *        computed against an environment which was invalidated in the meantime is dropped rather than cached.
+ */
+template <typename ValueT> class EdgeCache
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param capacity  maximum number of cached edges; rounded up to a power of two, and to at least one bucket
+   */
+  explicit EdgeCache(const std::size_t capacity) :
+      slots_(round_up_to_power_of_two(capacity < WAYS ? WAYS : capacity)),
+      locks_(LOCK_COUNT)
+  {
+    mask_ = slots_.size() / WAYS - 1;
+  }
+
+  EdgeCache(const EdgeCache&) = delete;
+
+  EdgeCache& operator=(const EdgeCache&) = delete;
+
+  /**
+   * @brief Returns number of slots in the table
+   */
+  inline std::size_t capacity() const { return slots_.size(); }
+
+  /**
+   * @brief Returns current cache version
+   */
+  inline std::uint32_t version() const { return version_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Discards all cached entries
+   */
+  inline void invalidate() { version_.fetch_add(1, std::memory_order_acq_rel); }
+
+  /**
+   * @brief Looks up cached validity of the edge from <code>parent_id</code> to <code>child_id</code>
+   *
+   * @param[out] valid  cached validity; only written on a hit
+   *
+   * @return true if validity was cached
+   */
+  inline bool try_get_validity(const std::uint64_t parent_id, const std::uint64_t child_id, bool& valid) const
+  {
+    const std::size_t bucket = bucket_of(parent_id, child_id);
+    std::lock_guard<std::mutex> lock{lock_of(bucket)};
+    const Slot* const entry = find(bucket, parent_id, child_id);
+    if (entry == nullptr or !(entry->flags & VALIDITY_KNOWN))
+    {
+      return false;
+    }
+    valid = entry->flags & VALID;
+    return true;
+  }
+
+  /**
+   * @brief Caches validity of the edge from <code>parent_id</code> to <code>child_id</code>
+   *
+   * @param version  cache version read before validity was computed; the write is dropped if it is out of date
+   */
+  inline void set_validity(
+    const std::uint64_t parent_id,
+    const std::uint64_t child_id,
+    const bool valid,
+    const std::uint32_t version)
+  {
+    const std::size_t bucket = bucket_of(parent_id, child_id);
+    std::lock_guard<std::mutex> lock{lock_of(bucket)};
+    if (version != this->version())
+    {
+      return;
+    }
+    Slot& entry = claim(bucket, parent_id, child_id, version);
+    entry.flags = (entry.flags & ~VALID) | VALIDITY_KNOWN | (valid ? VALID : 0);
+  }
+
+  /**
+   * @brief Looks up cached value of the edge from <code>parent_id</code> to <code>child_id</code>
+   *
+   * @param[out] value  cached value; only written on a hit
+   *
+   * @return true if value was cached
+   */
+  inline bool try_get_value(const std::uint64_t parent_id, const std::uint64_t child_id, ValueT& value) const
+  {
+    const std::size_t bucket = bucket_of(parent_id, child_id);
+    std::lock_guard<std::mutex> lock{lock_of(bucket)};
+    const Slot* const entry = find(bucket, parent_id, child_id);
+    if (entry == nullptr or !(entry->flags & VALUE_KNOWN))
+    {
+      return false;
+    }
+    value = entry->value;
+    return true;
+  }
+
+  /**
+   * @brief Caches value of the edge from <code>parent_id</code> to <code>child_id</code>
+   *
+   * @param version  cache version read before value was computed; the write is dropped if it is out of date
+   */
+  inline void set_value(
+    const std::uint64_t parent_id,
+    const std::uint64_t child_id,
+    const ValueT& value,
+    const std::uint32_t version)
+  {
+    const std::size_t bucket = bucket_of(parent_id, child_id);
+    std::lock_guard<std::mutex> lock{lock_of(bucket)};
+    if (version != this->version())
+    {
+      return;
+    }
+    Slot& entry = claim(bucket, parent_id, child_id, version);
+    entry.flags |= VALUE_KNOWN;
+    entry.value = value;
+  }
+
+private:
+  /// Number of slots per bucket
+  static constexpr std::size_t WAYS = 4;
+
+  /// Number of striped bucket locks
+  static constexpr std::size_t LOCK_COUNT = 64;
+
+  /// Entry flag set once validity is cached
+  static constexpr std::uint8_t VALIDITY_KNOWN = 1;
+
+  /// Entry flag holding cached validity
+  static constexpr std::uint8_t VALID = 2;
+
+  /// Entry flag set once value is cached
+  static constexpr std::uint8_t VALUE_KNOWN = 4;
+
+  /**
+   * @brief Cached edge entry
+   */
+  struct Slot
+  {
+    std::uint64_t parent_id = 0;
+    std::uint64_t child_id = 0;
+    std::uint32_t version = 0;
+    std::uint8_t flags = 0;
+    /// Eviction counter of the bucket; only used in its first slot
+    std::uint8_t evictions = 0;
+    ValueT value{};
+
+    inline bool matches(const std::uint64_t _parent_id, const std::uint64_t _child_id, const std::uint32_t _version)
+      const
+    {
+      return flags != 0 and version == _version and parent_id == _parent_id and child_id == _child_id;
+    }
+  };
+
+  static inline std::size_t round_up_to_power_of_two(const std::size_t n)
+  {
+    std::size_t size = 1;
+    while (size < n)
+    {
+      size <<= 1;
+    }
+    return size;
+  }
+
+  /**
+   * @brief Returns bucket of the edge from <code>parent_id</code> to <code>child_id</code>
+   */
+  inline std::size_t bucket_of(const std::uint64_t parent_id, const std::uint64_t child_id) const
+  {
+    std::uint64_t hash = parent_id * 0x9E3779B97F4A7C15ULL ^ child_id * 0xC2B2AE3D27D4EB4FULL;
+    hash ^= hash >> 29;
+    return static_cast<std::size_t>(hash) & mask_;
+  }
+
+  /**
+   * @brief Returns lock guarding <code>bucket</code>
+   */
+  inline std::mutex& lock_of(const std::size_t bucket) const { return locks_[bucket % LOCK_COUNT]; }
+
+  /**
+   * @brief Returns current entry for the given edge in <code>bucket</code>; nullptr if there is none
+   */
+  inline const Slot* find(const std::size_t bucket, const std::uint64_t parent_id, const std::uint64_t child_id) const
+  {
+    const std::uint32_t current = version();
+    const Slot* const first = slots_.data() + bucket * WAYS;
+    for (const Slot* entry = first; entry != first + WAYS; ++entry)
+    {
+      if (entry->matches(parent_id, child_id, current))
+      {
+        return entry;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Returns entry for the given edge in <code>bucket</code> at <code>current</code> version, claiming a slot
+   *        for it if there is none
+   *
+   *        Empty or stale slots are claimed first; otherwise, slots of a full bucket are evicted in turn. Claimed
+   *        slots are stamped with <code>current</code> rather than the latest version, so an invalidation racing with
+   *        the write still discards it.
+   */
+  inline Slot& claim(
+    const std::size_t bucket,
+    const std::uint64_t parent_id,
+    const std::uint64_t child_id,
+    const std::uint32_t current)
+  {
+    Slot* const first = slots_.data() + bucket * WAYS;
+
+    Slot* victim = nullptr;
+    for (Slot* entry = first; entry != first + WAYS; ++entry)
+    {
+      if (entry->matches(parent_id, child_id, current))
+      {
+        return *entry;
+      }
+      else if (victim == nullptr and (entry->flags == 0 or entry->version != current))
+      {
+        victim = entry;
+      }
+    }
+
+    if (victim == nullptr)
+    {
+      victim = first + (first->evictions++ % WAYS);
+    }
+
+    const std::uint8_t evictions = victim->evictions;
+    *victim = Slot{parent_id, child_id, current, 0, evictions, ValueT{}};
+    return *victim;
+  }
+
+  /// Table of cached edges, <code>WAYS</code> consecutive slots per bucket
+  std::vector<Slot> slots_;
+
+  /// Bucket index mask
+  std::size_t mask_;
+
+  /// Striped bucket locks
+  mutable std::vector<std::mutex> locks_;
+
+  /// Current cache version
+  std::atomic<std::uint32_t> version_{0};
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EDGE_CACHE_H
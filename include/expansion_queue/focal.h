@@ -0,0 +1,248 @@
+#ifndef MMPL_EXPANSION_QUEUE_FOCAL_H
+#define MMPL_EXPANSION_QUEUE_FOCAL_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_queue.h>
+#include <mmpl/support.h>
+
+namespace mmpl::expansion_queue
+{
+
+/**
+ * @brief Expansion queue for bounded-suboptimal focal search
+ *
+ *        Entries are held in two ordered sets:
+ *        - OPEN, holding all entries ordered by <code>f = total_value + heuristic(state)</code>
+ *        - FOCAL, holding those entries of OPEN with <code>f <= weight * f_min</code>, ordered by a secondary key
+ *
+ *        Entries are dequeued from FOCAL, lowest secondary key first (e.g. fewest steps or conflicts to go). With an
+ *        admissible heuristic, paths found by a planner using this queue are at most <code>weight</code> times as
+ *        valuable as optimal paths.
+ *
+ *        FOCAL is maintained incrementally: when <code>f_min</code> moves, only the entries of OPEN between the old and
+ *        new bounds are moved into (or out of) FOCAL, which is a single range walk over OPEN.
+ *
+ *        <code>HeuristicFnT</code> is invoked as <code>heuristic(state)</code>, and <code>SecondaryFnT</code> as
+ *        <code>secondary(state, total_value)</code>; both must return arithmetic values.
+ *
+ * @note Values must be arithmetic and non-negative
+ */
+template <typename StateT, typename ValueT, typename HeuristicFnT, typename SecondaryFnT>
+class Focal : public ExpansionQueueBase<Focal<StateT, ValueT, HeuristicFnT, SecondaryFnT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param weight  suboptimality bound; at least 1
+   * @param heuristic  admissible estimate of the remaining value from a state to the goal
+   * @param secondary  FOCAL ordering key
+   */
+  Focal(const double weight, HeuristicFnT heuristic, SecondaryFnT secondary) :
+      weight_{weight},
+      heuristic_{std::move(heuristic)},
+      secondary_{std::move(secondary)}
+  {
+    MMPL_RUNTIME_ASSERT(weight_ >= 1.0);
+  }
+
+  /**
+   * @brief Returns suboptimality bound
+   */
+  inline double weight() const { return weight_; }
+
+  /**
+   * @brief Returns number of entries in OPEN
+   */
+  inline std::size_t open_size() const { return open_.size(); }
+
+  /**
+   * @brief Returns number of entries in FOCAL
+   */
+  inline std::size_t focal_size() const { return focal_.size(); }
+
+private:
+  static_assert(std::is_arithmetic<ValueT>(), MMPL_STATIC_ASSERT_MSG("Focal search requires arithmetic values"));
+
+  using HeuristicType = std::decay_t<decltype(std::declval<HeuristicFnT&>()(std::declval<const StateT&>()))>;
+
+  using KeyType = std::common_type_t<ValueT, HeuristicType>;
+
+  using SecondaryType = std::decay_t<decltype(
+    std::declval<SecondaryFnT&>()(std::declval<const StateT&>(), std::declval<const ValueT&>()))>;
+
+  /// OPEN entry: (f, payload index)
+  using OpenEntry = std::pair<KeyType, std::uint32_t>;
+
+  /// FOCAL entry: (secondary key, f, payload index)
+  using FocalEntry = std::tuple<SecondaryType, KeyType, std::uint32_t>;
+
+  /**
+   * @brief Queued state and value, with its secondary key
+   */
+  struct Payload
+  {
+    StateValue<StateT, ValueT> state_value;
+    SecondaryType secondary;
+  };
+
+  /**
+   * @brief Moves entries between OPEN and FOCAL after <code>f_min</code> changed
+   */
+  inline void update_bound()
+  {
+    if (open_.empty())
+    {
+      bound_ = std::numeric_limits<KeyType>::lowest();
+      return;
+    }
+
+    const auto next_bound = static_cast<KeyType>(weight_ * static_cast<double>(open_.begin()->first));
+    if (bound_ < next_bound)
+    {
+      // Admit entries with f in (bound, next_bound]
+      for (auto itr = open_.upper_bound(OpenEntry{bound_, NO_INDEX});
+           itr != open_.end() and !(next_bound < itr->first);
+           ++itr)
+      {
+        focal_.emplace(payloads_[itr->second].secondary, itr->first, itr->second);
+      }
+    }
+    else if (next_bound < bound_)
+    {
+      // Evict entries with f in (next_bound, bound]
+      for (auto itr = open_.upper_bound(OpenEntry{next_bound, NO_INDEX});
+           itr != open_.end() and !(bound_ < itr->first);
+           ++itr)
+      {
+        focal_.erase(FocalEntry{payloads_[itr->second].secondary, itr->first, itr->second});
+      }
+    }
+    bound_ = next_bound;
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::reset
+   */
+  inline void reset_impl()
+  {
+    open_.clear();
+    focal_.clear();
+    payloads_.clear();
+    free_.clear();
+    bound_ = std::numeric_limits<KeyType>::lowest();
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::empty
+   */
+  inline bool empty_impl() const { return open_.empty(); }
+
+  /**
+   * @copydoc ExpansionQueueBase::enqueue
+   */
+  inline void enqueue_impl(const StateT& state, const ValueT& total_value)
+  {
+    Payload payload{StateValue<StateT, ValueT>{state, total_value}, secondary_(state, total_value)};
+
+    std::uint32_t index;
+    if (free_.empty())
+    {
+      index = static_cast<std::uint32_t>(payloads_.size());
+      payloads_.push_back(std::move(payload));
+    }
+    else
+    {
+      index = free_.back();
+      free_.pop_back();
+      payloads_[index] = std::move(payload);
+    }
+
+    const KeyType f = static_cast<KeyType>(total_value) + static_cast<KeyType>(heuristic_(state));
+    const bool is_new_min = open_.empty() or f < open_.begin()->first;
+    open_.emplace(f, index);
+
+    if (is_new_min)
+    {
+      update_bound();
+    }
+    if (!(bound_ < f))
+    {
+      focal_.emplace(payloads_[index].secondary, f, index);
+    }
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::next
+   */
+  inline StateValue<StateT, ValueT> next_impl()
+  {
+    MMPL_RUNTIME_ASSERT(!focal_.empty());
+    const auto [secondary, f, index] = *focal_.begin();
+    focal_.erase(focal_.begin());
+
+    const bool was_min = open_.begin()->second == index;
+    open_.erase(OpenEntry{f, index});
+    free_.push_back(index);
+
+    if (was_min)
+    {
+      update_bound();
+    }
+    return std::move(payloads_[index].state_value);
+  }
+
+  /// Payload index larger than all others, used as a search sentinel
+  static constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+  /// Suboptimality bound
+  double weight_;
+
+  /// Admissible value-to-go estimate
+  HeuristicFnT heuristic_;
+
+  /// FOCAL ordering key
+  SecondaryFnT secondary_;
+
+  /// Current FOCAL bound, <code>weight * f_min</code>
+  KeyType bound_ = std::numeric_limits<KeyType>::lowest();
+
+  /// All queued entries, by f
+  std::set<OpenEntry> open_;
+
+  /// Queued entries within the FOCAL bound, by secondary key
+  std::set<FocalEntry> focal_;
+
+  /// Queued states and values
+  std::vector<Payload> payloads_;
+
+  /// Payload slots which are not in use
+  std::vector<std::uint32_t> free_;
+
+  friend class ExpansionQueueBase<Focal<StateT, ValueT, HeuristicFnT, SecondaryFnT>>;
+};
+
+}  // namespace mmpl::expansion_queue
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename HeuristicFnT, typename SecondaryFnT>
+struct ExpansionQueueTraits<expansion_queue::Focal<StateT, ValueT, HeuristicFnT, SecondaryFnT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_QUEUE_FOCAL_H
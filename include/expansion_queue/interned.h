@@ -0,0 +1,113 @@
+#ifndef MMPL_EXPANSION_QUEUE_INTERNED_H
+#define MMPL_EXPANSION_QUEUE_INTERNED_H
+
+// C++ Standard Library
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_queue.h>
+#include <mmpl/state_pool.h>
+
+namespace mmpl::expansion_queue
+{
+
+/**
+ * @brief Min-sorted expansion queue which holds state handles in place of states
+ *
+ *        Enqueued states are interned in a StatePool, and the heap holds only (value, handle) pairs, which is 8 bytes
+ *        per entry for 32-bit values regardless of the state type. States are copied out of the pool when popped.
+ *
+ * @warn Referenced state pool must outlive this object
+ */
+template <typename StateT, typename ValueT, typename HashT = state_default_hash_t<StateT>>
+class Interned : public ExpansionQueueBase<Interned<StateT, ValueT, HashT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param pool  state pool; may be shared with an expansion_table::Interned
+   */
+  explicit Interned(StatePool<StateT, HashT>& pool) : pool_{std::addressof(pool)} {}
+
+  /**
+   * @brief Returns state pool
+   */
+  inline const StatePool<StateT, HashT>& pool() const { return *pool_; }
+
+private:
+  /**
+   * @brief Queued state handle and total value
+   */
+  struct Entry
+  {
+    /// Total value
+    ValueT value;
+
+    /// Handle of queued state
+    StateHandle handle;
+
+    inline bool operator>(const Entry& other) const { return this->value > other.value; }
+  };
+
+  using QueueType = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>;
+
+  /**
+   * @copydoc ExpansionQueueBase::reset
+   */
+  inline void reset_impl()
+  {
+    QueueType swap_queue;
+    queue_.swap(swap_queue);
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::empty
+   */
+  inline bool empty_impl() const { return queue_.empty(); }
+
+  /**
+   * @copydoc ExpansionQueueBase::enqueue
+   */
+  inline void enqueue_impl(const StateT& state, const ValueT& total_value)
+  {
+    queue_.push(Entry{total_value, pool_->intern(state)});
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::next
+   */
+  inline StateValue<StateT, ValueT> next_impl()
+  {
+    const Entry entry = queue_.top();
+    queue_.pop();
+    return StateValue<StateT, ValueT>{pool_->state(entry.handle), entry.value};
+  }
+
+  /// Interned states
+  StatePool<StateT, HashT>* pool_;
+
+  /// Underlying priority queue
+  QueueType queue_;
+
+  friend class ExpansionQueueBase<Interned<StateT, ValueT, HashT>>;
+};
+
+}  // namespace mmpl::expansion_queue
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename HashT>
+struct ExpansionQueueTraits<expansion_queue::Interned<StateT, ValueT, HashT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_QUEUE_INTERNED_H
@@ -3,31 +3,47 @@
 
 // C++ Standard Library
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <queue>
+#include <utility>
 #include <vector>
 
 // MMPL
 #include <mmpl/expansion_queue.h>
+#include <mmpl/expansion_queue/tie_breaking.h>
 
 namespace mmpl::expansion_queue
 {
 
 /**
  * @brief Expansion queue based on a min-sorted <code>std::priority_queue</code> (heap)
+ *
+ *        Entries with equal values are ordered by <code>TieBreakingT</code> (see tie_breaking); unless ties are
+ *        arbitrary, each entry holds one extra tie key word
  */
-template <typename StateT, typename ValueT, typename StateValueAllocatorT = std::allocator<StateValue<StateT, ValueT>>>
-class MinSorted : public ExpansionQueueBase<MinSorted<StateT, ValueT, StateValueAllocatorT>>
+template <
+  typename StateT,
+  typename ValueT,
+  typename StateValueAllocatorT = std::allocator<StateValue<StateT, ValueT>>,
+  typename TieBreakingT = tie_breaking::Arbitrary>
+class MinSorted : public ExpansionQueueBase<MinSorted<StateT, ValueT, StateValueAllocatorT, TieBreakingT>>
 {
+  using EntryTraits = TieBrokenEntry<StateT, ValueT, TieBreakingT>;
+  using EntryType = typename EntryTraits::Type;
+  using EntryAllocatorType = typename std::allocator_traits<StateValueAllocatorT>::template rebind_alloc<EntryType>;
+  using QueueType = std::priority_queue<EntryType, std::vector<EntryType, EntryAllocatorType>, std::greater<EntryType>>;
+
 public:
   MinSorted() = default;
 
-  explicit MinSorted(std::size_t reserved) :
-      queue_{std::greater<StateValueType>{}, [reserved]() -> std::vector<StateValueType, StateValueAllocatorT> {
-               std::vector<StateValueType, StateValueAllocatorT> c;
-               c.reserved(reserved);
+  explicit MinSorted(std::size_t reserved, TieBreakingT tie_breaking = TieBreakingT{}) :
+      queue_{std::greater<EntryType>{}, [reserved]() -> std::vector<EntryType, EntryAllocatorType> {
+               std::vector<EntryType, EntryAllocatorType> c;
+               c.reserve(reserved);
                return c;
-             }()}
+             }()},
+      tie_breaking_{std::move(tie_breaking)}
   {}
 
 private:
@@ -38,8 +54,7 @@ private:
    */
   inline void reset_impl()
   {
-    std::priority_queue<StateValueType, std::vector<StateValueType, StateValueAllocatorT>, std::greater<StateValueType>>
-      swap_queue;
+    QueueType swap_queue;
     queue_.swap(swap_queue);
   }
 
@@ -51,23 +66,28 @@ private:
   /**
    * @copydoc ExpansionQueueBase::enqueue
    */
-  inline void enqueue_impl(const StateT& state, const ValueT& total_value) { queue_.emplace(state, total_value); }
+  inline void enqueue_impl(const StateT& state, const ValueT& total_value)
+  {
+    queue_.push(EntryTraits::make(tie_breaking_, state, total_value));
+  }
 
   /**
    * @copydoc ExpansionQueueBase::next
    */
   inline StateValueType next_impl()
   {
-    const auto v = queue_.top();
+    const StateValueType v = EntryTraits::get(queue_.top());
     queue_.pop();
     return v;
   }
 
   /// Underlying priority queue
-  std::priority_queue<StateValueType, std::vector<StateValueType, StateValueAllocatorT>, std::greater<StateValueType>>
-    queue_;
+  QueueType queue_;
+
+  /// Tie-breaking policy
+  TieBreakingT tie_breaking_;
 
-  friend class ExpansionQueueBase<MinSorted<StateT, ValueT, StateValueAllocatorT>>;
+  friend class ExpansionQueueBase<MinSorted<StateT, ValueT, StateValueAllocatorT, TieBreakingT>>;
 };
 
 }  // namespace mmpl::expansion_queue
@@ -75,8 +95,8 @@ private:
 namespace mmpl
 {
 
-template <typename StateT, typename ValueT, typename StateValueAllocatorT>
-struct ExpansionQueueTraits<expansion_queue::MinSorted<StateT, ValueT, StateValueAllocatorT>>
+template <typename StateT, typename ValueT, typename StateValueAllocatorT, typename TieBreakingT>
+struct ExpansionQueueTraits<expansion_queue::MinSorted<StateT, ValueT, StateValueAllocatorT, TieBreakingT>>
 {
   using StateType = StateT;
   using ValueType = ValueT;
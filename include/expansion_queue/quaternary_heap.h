@@ -0,0 +1,322 @@
+#ifndef MMPL_EXPANSION_QUEUE_QUATERNARY_HEAP_H
+#define MMPL_EXPANSION_QUEUE_QUATERNARY_HEAP_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_queue.h>
+#include <mmpl/expansion_queue/tie_breaking.h>
+#include <mmpl/value.h>
+
+namespace mmpl::expansion_queue
+{
+
+/**
+ * @brief Scalar key on which heap entries with values of type <code>ValueT</code> are ordered
+ *
+ *        Arithmetic values are their own key
+ */
+template <typename ValueT> struct HeapKey
+{
+  using Type = ValueT;
+
+  static constexpr Type get(const ValueT& value) { return value; }
+};
+
+
+/**
+ * @brief Heuristic values are ordered on their total (f) value
+ */
+template <typename ValueT, typename HeuristicT> struct HeapKey<HeuristicValue<ValueT, HeuristicT>>
+{
+  using Type = ValueT;
+
+  static constexpr Type get(const HeuristicValue<ValueT, HeuristicT>& value) { return value.f(); }
+};
+
+
+/**
+ * @brief Heap key extended by a tie key, which orders entries with equal heap keys
+ */
+template <typename KeyT, typename TieT> struct TieBrokenHeapKey
+{
+  /// Primary key
+  KeyT key;
+
+  /// Tie key
+  TieT tie;
+
+  constexpr bool operator<(const TieBrokenHeapKey& other) const
+  {
+    return (this->key < other.key) or (!(other.key < this->key) and this->tie < other.tie);
+  }
+};
+
+
+/**
+ * @brief Heap key type of entries ordered by tie-breaking policy <code>TieBreakingT</code>
+ */
+template <typename StateT, typename ValueT, typename TieBreakingT> struct HeapKeyWithTies
+{
+  using TieType = tie_key_t<StateT, ValueT, TieBreakingT>;
+
+  static_assert(
+    sizeof(TieType) <= sizeof(std::uint64_t),
+    MMPL_STATIC_ASSERT_MSG("Tie keys must not be larger than a single word"));
+
+  using Type = TieBrokenHeapKey<typename HeapKey<ValueT>::Type, TieType>;
+};
+
+
+template <typename StateT, typename ValueT> struct HeapKeyWithTies<StateT, ValueT, tie_breaking::Arbitrary>
+{
+  using Type = typename HeapKey<ValueT>::Type;
+};
+
+
+/**
+ * @brief Allocator which aligns storage to cache lines
+ */
+template <typename T> struct CacheAlignedAllocator
+{
+  using value_type = T;
+
+  /// Assumed cache line size, in bytes
+  static constexpr std::size_t alignment = 64;
+
+  CacheAlignedAllocator() = default;
+
+  template <typename U> constexpr CacheAlignedAllocator(const CacheAlignedAllocator<U>&) noexcept {}
+
+  inline T* allocate(const std::size_t n)
+  {
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignment}));
+  }
+
+  inline void deallocate(T* const p, const std::size_t n) noexcept
+  {
+    ::operator delete(p, n * sizeof(T), std::align_val_t{alignment});
+  }
+
+  template <typename U> constexpr bool operator==(const CacheAlignedAllocator<U>&) const noexcept { return true; }
+
+  template <typename U> constexpr bool operator!=(const CacheAlignedAllocator<U>&) const noexcept { return false; }
+};
+
+
+/**
+ * @brief Expansion queue based on a 4-ary min-heap stored as a structure of arrays
+ *
+ *        The heap itself only holds a scalar key (see HeapKey) and a 32-bit payload index per entry, in two separate,
+ *        cache-line aligned arrays; queued states and values are kept in a side array of payloads, which are never
+ *        moved while queued. Sifting therefore only moves keys and indices, and compares keys directly.
+ *
+ *        Heap entries are offset so that the four children of a node always start on a four-entry boundary; for keys
+ *        of up to 16 bytes, all children of a node share a single cache line, so each level of a sift-down touches
+ *        one key line. A 4-ary heap is also half as deep as a binary heap.
+ *
+ *        Entries with equal keys are ordered by <code>TieBreakingT</code> (see tie_breaking); unless ties are
+ *        arbitrary, the tie key is packed next to the heap key, as a single TieBrokenHeapKey.
+ */
+template <typename StateT, typename ValueT, typename TieBreakingT = tie_breaking::Arbitrary>
+class QuaternaryHeap : public ExpansionQueueBase<QuaternaryHeap<StateT, ValueT, TieBreakingT>>
+{
+public:
+  QuaternaryHeap() { reset_impl(); }
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param reserved  number of entries to reserve space for
+   * @param tie_breaking  tie-breaking policy
+   */
+  explicit QuaternaryHeap(const std::size_t reserved, TieBreakingT tie_breaking = TieBreakingT{}) :
+      tie_breaking_{std::move(tie_breaking)}
+  {
+    reset_impl();
+    keys_.reserve(reserved + OFFSET);
+    indices_.reserve(reserved + OFFSET);
+    payloads_.reserve(reserved);
+  }
+
+  /**
+   * @brief Returns number of queued entries
+   */
+  inline std::size_t size() const { return keys_.size() - OFFSET; }
+
+private:
+  using KeyType = typename HeapKeyWithTies<StateT, ValueT, TieBreakingT>::Type;
+
+  /// Number of children per node
+  static constexpr std::size_t ARITY = 4;
+
+  /// Position of the root entry; aligns each group of children to an <code>ARITY</code>-entry boundary
+  static constexpr std::size_t OFFSET = ARITY - 1;
+
+  /**
+   * @brief Returns position of the first child of the entry at <code>pos</code>
+   */
+  static constexpr std::size_t first_child(const std::size_t pos) { return ARITY * (pos - OFFSET) + OFFSET + 1; }
+
+  /**
+   * @brief Returns position of the parent of the entry at <code>pos</code>
+   */
+  static constexpr std::size_t parent(const std::size_t pos) { return (pos - OFFSET - 1) / ARITY + OFFSET; }
+
+  /**
+   * @brief Returns heap key of an entry
+   */
+  inline KeyType make_key(const StateT& state, const ValueT& total_value)
+  {
+    if constexpr (std::is_same<TieBreakingT, tie_breaking::Arbitrary>::value)
+    {
+      return HeapKey<ValueT>::get(total_value);
+    }
+    else
+    {
+      return KeyType{HeapKey<ValueT>::get(total_value), tie_breaking_(state, total_value)};
+    }
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::reset
+   */
+  inline void reset_impl()
+  {
+    keys_.assign(OFFSET, KeyType{});
+    indices_.assign(OFFSET, 0);
+    payloads_.clear();
+    free_.clear();
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::empty
+   */
+  inline bool empty_impl() const { return keys_.size() == OFFSET; }
+
+  /**
+   * @copydoc ExpansionQueueBase::enqueue
+   */
+  inline void enqueue_impl(const StateT& state, const ValueT& total_value)
+  {
+    // Place payload in a free slot
+    std::uint32_t index;
+    if (free_.empty())
+    {
+      index = static_cast<std::uint32_t>(payloads_.size());
+      payloads_.emplace_back(state, total_value);
+    }
+    else
+    {
+      index = free_.back();
+      free_.pop_back();
+      payloads_[index] = StateValue<StateT, ValueT>{state, total_value};
+    }
+
+    // Sift new entry up from a hole at the end of the heap
+    const KeyType key = make_key(state, total_value);
+    std::size_t pos = keys_.size();
+    keys_.emplace_back();
+    indices_.emplace_back();
+    while (pos > OFFSET)
+    {
+      const std::size_t up = parent(pos);
+      if (!(key < keys_[up]))
+      {
+        break;
+      }
+      keys_[pos] = keys_[up];
+      indices_[pos] = indices_[up];
+      pos = up;
+    }
+    keys_[pos] = key;
+    indices_[pos] = index;
+  }
+
+  /**
+   * @copydoc ExpansionQueueBase::next
+   */
+  inline StateValue<StateT, ValueT> next_impl()
+  {
+    const std::uint32_t top_index = indices_[OFFSET];
+    StateValue<StateT, ValueT> top{std::move(payloads_[top_index])};
+    free_.push_back(top_index);
+
+    // Sift last entry down from a hole at the root
+    const KeyType key = keys_.back();
+    const std::uint32_t index = indices_.back();
+    keys_.pop_back();
+    indices_.pop_back();
+
+    const std::size_t end = keys_.size();
+    if (end == OFFSET)
+    {
+      return top;
+    }
+
+    std::size_t pos = OFFSET;
+    for (std::size_t child = first_child(pos); child < end; child = first_child(pos))
+    {
+      // Find smallest of up to ARITY children
+      const std::size_t last = (child + ARITY < end) ? (child + ARITY) : end;
+      std::size_t min_child = child;
+      for (std::size_t other = child + 1; other < last; ++other)
+      {
+        if (keys_[other] < keys_[min_child])
+        {
+          min_child = other;
+        }
+      }
+
+      if (!(keys_[min_child] < key))
+      {
+        break;
+      }
+      keys_[pos] = keys_[min_child];
+      indices_[pos] = indices_[min_child];
+      pos = min_child;
+    }
+    keys_[pos] = key;
+    indices_[pos] = index;
+    return top;
+  }
+
+  /// Heap entry keys
+  std::vector<KeyType, CacheAlignedAllocator<KeyType>> keys_;
+
+  /// Heap entry payload indices
+  std::vector<std::uint32_t, CacheAlignedAllocator<std::uint32_t>> indices_;
+
+  /// Queued states and values
+  std::vector<StateValue<StateT, ValueT>> payloads_;
+
+  /// Payload slots which are not in use
+  std::vector<std::uint32_t> free_;
+
+  /// Tie-breaking policy
+  TieBreakingT tie_breaking_;
+
+  friend class ExpansionQueueBase<QuaternaryHeap<StateT, ValueT, TieBreakingT>>;
+};
+
+}  // namespace mmpl::expansion_queue
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename TieBreakingT>
+struct ExpansionQueueTraits<expansion_queue::QuaternaryHeap<StateT, ValueT, TieBreakingT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_QUEUE_QUATERNARY_HEAP_H
@@ -0,0 +1,157 @@
+#ifndef MMPL_EXPANSION_QUEUE_TIE_BREAKING_H
+#define MMPL_EXPANSION_QUEUE_TIE_BREAKING_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// MMPL
+#include <mmpl/expansion_queue.h>
+#include <mmpl/support.h>
+#include <mmpl/value.h>
+
+/**
+ * @brief Policies which order queue entries with equal values
+ *
+ *        A policy is a callable invoked as <code>policy(state, total_value)</code> when an entry is enqueued, which
+ *        returns a single-word tie key; among entries with equal values, the one with the smallest tie key is dequeued
+ *        first. Policies may be stateful, and are held by the queue.
+ */
+namespace mmpl::expansion_queue::tie_breaking
+{
+
+/**
+ * @brief Leaves ties in arbitrary order; queues add no tie key to their entries
+ */
+struct Arbitrary
+{};
+
+
+/**
+ * @brief Prefers entries with higher accumulated value (g), i.e. those closest to a goal under the heuristic
+ *
+ *        Requires HeuristicValue total values. On plateaus of equal f-values, this expands deep entries first, so
+ *        A*-style searches head straight for the goal instead of sweeping the whole plateau.
+ */
+struct HigherG
+{
+  template <typename StateT, typename ValueT, typename HeuristicT>
+  inline HeuristicT
+  operator()([[maybe_unused]] const StateT& state, const HeuristicValue<ValueT, HeuristicT>& total_value) const
+  {
+    return total_value.h();
+  }
+};
+
+
+/**
+ * @brief Prefers the most recently enqueued entry
+ */
+class Lifo
+{
+public:
+  template <typename StateT, typename ValueT>
+  inline std::uint64_t operator()([[maybe_unused]] const StateT& state, [[maybe_unused]] const ValueT& total_value)
+  {
+    return ~(count_++);
+  }
+
+private:
+  /// Number of enqueued entries
+  std::uint64_t count_ = 0;
+};
+
+
+/**
+ * @brief Prefers entries with the smallest user-defined key
+ *
+ *        <code>KeyFnT</code> is invoked as <code>key_fn(state, total_value)</code>, and must return a value no larger
+ *        than a single word (e.g. distance-to-go, or a conflict count)
+ */
+template <typename KeyFnT> class UserKey
+{
+public:
+  UserKey() = default;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param key_fn  tie key function
+   */
+  explicit UserKey(KeyFnT key_fn) : key_fn_{std::move(key_fn)} {}
+
+  template <typename StateT, typename ValueT> inline auto operator()(const StateT& state, const ValueT& total_value)
+  {
+    return key_fn_(state, total_value);
+  }
+
+private:
+  /// Tie key function
+  KeyFnT key_fn_;
+};
+
+}  // namespace mmpl::expansion_queue::tie_breaking
+
+namespace mmpl::expansion_queue
+{
+
+/**
+ * @brief Type of tie key returned by <code>TieBreakingT</code>
+ */
+template <typename StateT, typename ValueT, typename TieBreakingT>
+using tie_key_t =
+  std::decay_t<decltype(std::declval<TieBreakingT&>()(std::declval<const StateT&>(), std::declval<const ValueT&>()))>;
+
+
+/**
+ * @brief Queue entry type for <code>TieBreakingT</code>
+ *
+ *        StateValue itself when ties are arbitrary; otherwise a StateValue extended by a single tie key word
+ */
+template <typename StateT, typename ValueT, typename TieBreakingT> struct TieBrokenEntry
+{
+  using TieType = tie_key_t<StateT, ValueT, TieBreakingT>;
+
+  static_assert(
+    sizeof(TieType) <= sizeof(std::uint64_t),
+    MMPL_STATIC_ASSERT_MSG("Tie keys must not be larger than a single word"));
+
+  using Type = TieBrokenEntry;
+
+  /// Queued state and value
+  StateValue<StateT, ValueT> state_value;
+
+  /// Tie key
+  TieType tie;
+
+  static inline TieBrokenEntry make(TieBreakingT& policy, const StateT& state, const ValueT& total_value)
+  {
+    return TieBrokenEntry{StateValue<StateT, ValueT>{state, total_value}, policy(state, total_value)};
+  }
+
+  static inline const StateValue<StateT, ValueT>& get(const TieBrokenEntry& entry) { return entry.state_value; }
+
+  inline bool operator>(const TieBrokenEntry& other) const
+  {
+    return (this->state_value.value > other.state_value.value) or
+      (this->state_value.value == other.state_value.value and this->tie > other.tie);
+  }
+};
+
+
+template <typename StateT, typename ValueT> struct TieBrokenEntry<StateT, ValueT, tie_breaking::Arbitrary>
+{
+  using Type = StateValue<StateT, ValueT>;
+
+  static inline Type make(tie_breaking::Arbitrary&, const StateT& state, const ValueT& total_value)
+  {
+    return Type{state, total_value};
+  }
+
+  static inline const StateValue<StateT, ValueT>& get(const Type& entry) { return entry; }
+};
+
+}  // namespace mmpl::expansion_queue
+
+#endif  // MMPL_EXPANSION_QUEUE_TIE_BREAKING_H
@@ -1,10 +1,17 @@
 #ifndef MMPL_EXPANSION_TABLE_H
 #define MMPL_EXPANSION_TABLE_H
 
+// C++ Standard Library
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
 // MMPL
 #include <mmpl/crtp.h>
 #include <mmpl/state.h>
 #include <mmpl/support.h>
+#include <mmpl/trace.h>
 #include <mmpl/value.h>
 
 namespace mmpl
@@ -21,6 +28,24 @@ template <typename ExpansionTableT>
 using expansion_table_value_t = typename ExpansionTableTraits<ExpansionTableT>::ValueType;
 
 
+/**
+ * @brief Checks if records of an expansion table are final once set
+ *
+ *        Tables which never improve a record after it is first set (e.g. tables specialized for unit-cost searches)
+ *        declare <code>ExpansionTableTraits::is_write_once = true</code>, which lets planners skip stale-entry checks
+ */
+template <typename ExpansionTableT, typename = void> struct expansion_table_is_write_once : std::false_type
+{};
+
+
+template <typename ExpansionTableT>
+struct expansion_table_is_write_once<
+  ExpansionTableT,
+  std::void_t<decltype(ExpansionTableTraits<ExpansionTableT>::is_write_once)>>
+    : std::integral_constant<bool, ExpansionTableTraits<ExpansionTableT>::is_write_once>
+{};
+
+
 /**
  * @brief Defines and interface for an object used to query state expansion
  */
@@ -53,6 +78,22 @@ public:
     return this->derived()->expand_impl(parent, child, total_value);
   }
 
+  /**
+   * @brief Sets or improves expansion information for a state
+   *
+   * @param parent  parent state
+   * @param child  child state
+   * @param total_value  total value associated with \p child when reached through \p parent
+   *
+   * @retval true  if <code>child</code> was not previously expanded, or if <code>total_value</code> improves on the
+   *               value previously associated with <code>child</code>
+   * @retval false  otherwise
+   */
+  inline bool relax(const StateType& parent, const StateType& child, const ValueType& total_value)
+  {
+    return this->derived()->relax_impl(parent, child, total_value);
+  }
+
   /**
    * @brief Check if state has been previously expanded
    *
@@ -63,6 +104,18 @@ public:
    */
   inline bool is_expanded(const StateType& query) const { return this->derived()->is_expanded_impl(query); }
 
+  /**
+   * @brief Batched counterpart of <code>is_expanded</code>
+   *
+   * @param queries  pointer to first of <code>count</code> contiguous query states
+   * @param[out] mask  pointer to first of <code>count</code> outputs; set to true where query has been expanded
+   * @param count  number of queries
+   */
+  inline void is_expanded(const StateType* const queries, bool* const mask, const std::size_t count) const
+  {
+    this->derived()->is_expanded_batch_impl(queries, mask, count);
+  }
+
   /**
    * @brief Returns predecessor state for a given <code>query</code> state
    *
@@ -91,6 +144,19 @@ public:
     return this->derived()->get_total_value_impl(query);
   }
 
+  /**
+   * @brief Returns number of states on the path from a search root to <code>terminal</code>, inclusive
+   *
+   * @param terminal  path terminal state
+   *
+   * @warn Expects the following precondition to be satisfied: <code>is_expanded(terminal) == true</code>
+   */
+  inline std::size_t path_length(const StateType& terminal) const
+  {
+    MMPL_RUNTIME_ASSERT(is_expanded(terminal));
+    return this->derived()->path_length_impl(terminal);
+  }
+
   /**
    * @brief Returns accumulated metric value <code>query</code> state
    *
@@ -104,6 +170,87 @@ public:
     return is_expanded(query) ? this->derived()->get_total_value_impl(query) : Invalid<ValueType>::value;
   }
 
+  /**
+   * @brief Batched counterpart of <code>try_get_total_value</code>
+   *
+   * @param queries  pointer to first of <code>count</code> contiguous query states
+   * @param[out] values  pointer to first of <code>count</code> outputs
+   * @param count  number of queries
+   */
+  inline void
+  try_get_total_value(const StateType* const queries, ValueType* const values, const std::size_t count) const
+  {
+    this->derived()->try_get_total_value_batch_impl(queries, values, count);
+  }
+
+  /**
+   * @brief Registers the sources of a multi-source search, in caller order
+   *
+   *        Called by <code>run_multi_source</code> after reset and before the sources are enqueued. Ignored by
+   *        tables which do not track sources.
+   *
+   * @param first  iterator to first source state
+   * @param last  iterator one past last source state
+   */
+  template <typename StateIteratorT> inline void set_sources(StateIteratorT first, StateIteratorT last)
+  {
+    this->derived()->set_sources_impl(first, last);
+  }
+
+protected:
+  /**
+   * @brief Default source registration; does nothing
+   */
+  template <typename StateIteratorT>
+  inline void set_sources_impl([[maybe_unused]] StateIteratorT first, [[maybe_unused]] StateIteratorT last)
+  {}
+
+  /**
+   * @brief Default path length; counts parent links back to a search root
+   *
+   *        Derived tables which record state depth may hide this with a constant-time implementation, provided that
+   *        depths stay exact when a state is relaxed after its children were expanded
+   */
+  inline std::size_t path_length_impl(StateType terminal) const
+  {
+    std::size_t length = 1;
+    for (auto parent = this->derived()->get_parent_impl(terminal); !(parent == terminal);
+         parent = this->derived()->get_parent_impl(terminal))
+    {
+      terminal = parent;
+      ++length;
+    }
+    return length;
+  }
+
+  /**
+   * @brief Default batched expansion check; evaluates <code>is_expanded_impl</code> per query
+   */
+  inline void is_expanded_batch_impl(const StateType* const queries, bool* const mask, const std::size_t count) const
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      mask[i] = this->derived()->is_expanded_impl(queries[i]);
+    }
+  }
+
+  /**
+   * @brief Default batched value lookup; evaluates <code>try_get_total_value</code> per query
+   *
+   *        Derived tables may hide this and <code>is_expanded_batch_impl</code> with implementations which probe all
+   *        queries together
+   */
+  inline void try_get_total_value_batch_impl(
+    const StateType* const queries,
+    ValueType* const values,
+    const std::size_t count) const
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      values[i] = this->try_get_total_value(queries[i]);
+    }
+  }
+
 private:
   static_assert(is_value<ValueType>(), MMPL_STATIC_ASSERT_MSG("ValueType must be a valid metric value type"));
 
@@ -111,24 +258,46 @@ private:
 };
 
 
+/**
+ * @brief Writes path from <code>terminal</code> back to its search root, inclusive
+ *
+ *        Walks parent links with one table lookup per state
+ *
+ * @param output  output iterator receiving path states, starting with <code>terminal</code>
+ * @param terminal  path terminal state
+ * @param expansion_table  expansion table holding search results
+ *
+ * @return output iterator one past the last written state
+ */
 template <typename OutputIteratorT, typename ExpansionTableT>
 OutputIteratorT generate_reverse_path(
   OutputIteratorT output,
   expansion_table_state_t<ExpansionTableT> terminal,
   const ExpansionTableBase<ExpansionTableT>& expansion_table)
 {
-  using ValueType = expansion_table_value_t<ExpansionTableT>;
+  MMPL_TRACE_SCOPE("path_extraction");
 
-  *(++output) = terminal;
-  while (expansion_table.get_total_value(terminal) != Null<ValueType>::value)
+  *output++ = terminal;
+  for (auto parent = expansion_table.get_parent(terminal); !(parent == terminal);
+       parent = expansion_table.get_parent(terminal))
   {
-    terminal = expansion_table.get_parent(terminal);
-    *(++output) = terminal;
+    terminal = parent;
+    *output++ = terminal;
   }
   return output;
 }
 
 
+/**
+ * @brief Writes path from <code>terminal</code> back to its search root, inclusive, stopping early at <code>last</code>
+ *
+ * @param output  output iterator receiving path states, starting with <code>terminal</code>
+ * @param last  output iterator at which to stop writing
+ * @param terminal  path terminal state
+ * @param expansion_table  expansion table holding search results
+ *
+ * @return output iterator one past the last written state
+ */
 template <typename OutputIteratorT, typename LastOutputIteratorT, typename ExpansionTableT>
 OutputIteratorT generate_reverse_path(
   OutputIteratorT output,
@@ -136,23 +305,198 @@ OutputIteratorT generate_reverse_path(
   expansion_table_state_t<ExpansionTableT> terminal,
   const ExpansionTableBase<ExpansionTableT>& expansion_table)
 {
-  using ValueType = expansion_table_value_t<ExpansionTableT>;
+  MMPL_TRACE_SCOPE("path_extraction");
 
   if (output == last)
   {
     return output;
   }
-  else
+
+  *output++ = terminal;
+  for (auto parent = expansion_table.get_parent(terminal); output != last and !(parent == terminal);
+       parent = expansion_table.get_parent(terminal))
   {
-    *(++output) = terminal;
+    terminal = parent;
+    *output++ = terminal;
   }
+  return output;
+}
+
+
+/**
+ * @brief Writes path of known <code>length</code> from the search root of <code>terminal</code> to
+ *        <code>terminal</code>, in forward order
+ *
+ *        The path is filled back-to-front, so it may be written directly into a preallocated buffer without reversal,
+ *        walking parent links once
+ *
+ * @param first  random access iterator to first element of output buffer
+ * @param length  number of states on the path, e.g. from a previous call to <code>path_length(terminal)</code>
+ * @param terminal  path terminal state
+ * @param expansion_table  expansion table holding search results
+ *
+ * @return iterator one past the last written state
+ *
+ * @warn Expects the following precondition to be satisfied: <code>length == path_length(terminal)</code>
+ */
+template <typename RandomAccessIteratorT, typename ExpansionTableT>
+RandomAccessIteratorT generate_path(
+  RandomAccessIteratorT first,
+  const std::size_t length,
+  expansion_table_state_t<ExpansionTableT> terminal,
+  const ExpansionTableBase<ExpansionTableT>& expansion_table)
+{
+  MMPL_TRACE_SCOPE("path_extraction");
+  MMPL_RUNTIME_ASSERT(length > 0);
 
-  while (output != last and expansion_table.get_total_value(terminal) != Null<ValueType>::value)
+  const RandomAccessIteratorT path_last = first + static_cast<std::ptrdiff_t>(length);
+
+  RandomAccessIteratorT output = path_last;
+  *(--output) = terminal;
+  for (auto parent = expansion_table.get_parent(terminal); output != first and !(parent == terminal);
+       parent = expansion_table.get_parent(terminal))
   {
-    terminal = expansion_table.get_parent(terminal);
-    *(++output) = terminal;
+    terminal = parent;
+    *(--output) = terminal;
   }
-  return output;
+  MMPL_RUNTIME_ASSERT(output == first and expansion_table.get_parent(terminal) == terminal);
+  return path_last;
+}
+
+
+/**
+ * @brief Writes path from the search root of <code>terminal</code> to <code>terminal</code>, in forward order
+ *
+ *        Sizes the path with <code>ExpansionTableBase::path_length</code>, then fills it back-to-front, which walks
+ *        parent links twice. Callers which know the path length already should pass it instead.
+ *
+ * @param first  random access iterator to first element of output buffer
+ * @param last  random access iterator one past last element of output buffer
+ * @param terminal  path terminal state
+ * @param expansion_table  expansion table holding search results
+ *
+ * @return iterator one past the last written state
+ *
+ * @warn Expects the following precondition to be satisfied: <code>path_length(terminal) <= (last - first)</code>
+ */
+template <typename RandomAccessIteratorT, typename ExpansionTableT>
+RandomAccessIteratorT generate_path(
+  RandomAccessIteratorT first,
+  [[maybe_unused]] RandomAccessIteratorT last,
+  const expansion_table_state_t<ExpansionTableT>& terminal,
+  const ExpansionTableBase<ExpansionTableT>& expansion_table)
+{
+  const std::size_t length = expansion_table.path_length(terminal);
+  MMPL_RUNTIME_ASSERT(static_cast<std::ptrdiff_t>(length) <= (last - first));
+  return generate_path(first, length, terminal, expansion_table);
+}
+
+
+/**
+ * @brief Lazy view over the path from a terminal state back to its search root
+ *
+ *        Parent links are followed as the view is iterated; no path storage is allocated
+ *
+ * @warn Referenced expansion table must outlive this object, and must not be modified while the view is in use
+ */
+template <typename ExpansionTableT> class ReversePathView
+{
+public:
+  using StateType = expansion_table_state_t<ExpansionTableT>;
+
+  /**
+   * @brief Forward iterator over path states, starting from the terminal state
+   */
+  class iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = StateType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const StateType*;
+    using reference = const StateType&;
+
+    iterator(const StateType& _state, const ExpansionTableBase<ExpansionTableT>* _expansion_table, const bool _done) :
+        state_{_state},
+        expansion_table_{_expansion_table},
+        done_{_done}
+    {}
+
+    inline reference operator*() const { return state_; }
+
+    inline pointer operator->() const { return std::addressof(state_); }
+
+    inline iterator& operator++()
+    {
+      const StateType parent = expansion_table_->get_parent(state_);
+      if (parent == state_)
+      {
+        done_ = true;
+      }
+      else
+      {
+        state_ = parent;
+      }
+      return *this;
+    }
+
+    inline iterator operator++(int)
+    {
+      iterator prev{*this};
+      ++(*this);
+      return prev;
+    }
+
+    inline bool operator==(const iterator& other) const
+    {
+      return (done_ and other.done_) or (!done_ and !other.done_ and state_ == other.state_);
+    }
+
+    inline bool operator!=(const iterator& other) const { return !(*this == other); }
+
+  private:
+    /// Current path state
+    StateType state_;
+
+    /// Expansion table holding search results
+    const ExpansionTableBase<ExpansionTableT>* expansion_table_;
+
+    /// Set once iteration has moved past the search root
+    bool done_;
+  };
+
+  ReversePathView(const StateType& terminal, const ExpansionTableBase<ExpansionTableT>& expansion_table) :
+      terminal_{terminal},
+      expansion_table_{std::addressof(expansion_table)}
+  {}
+
+  inline iterator begin() const { return iterator{terminal_, expansion_table_, false}; }
+
+  inline iterator end() const { return iterator{terminal_, expansion_table_, true}; }
+
+  /**
+   * @copydoc ExpansionTableBase::path_length
+   */
+  inline std::size_t size() const { return expansion_table_->path_length(terminal_); }
+
+private:
+  /// Path terminal state
+  StateType terminal_;
+
+  /// Expansion table holding search results
+  const ExpansionTableBase<ExpansionTableT>* expansion_table_;
+};
+
+
+/**
+ * @brief Returns a lazy view over the path from <code>terminal</code> back to its search root
+ */
+template <typename ExpansionTableT>
+inline ReversePathView<ExpansionTableT> reverse_path(
+  const expansion_table_state_t<ExpansionTableT>& terminal,
+  const ExpansionTableBase<ExpansionTableT>& expansion_table)
+{
+  return ReversePathView<ExpansionTableT>{terminal, expansion_table};
 }
 
 
@@ -0,0 +1,94 @@
+#ifndef MMPL_EXPANSION_TABLE_ATOMIC_RECORD_H
+#define MMPL_EXPANSION_TABLE_ATOMIC_RECORD_H
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// MMPL
+#include <mmpl/support.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Expansion record packed into a single atomic 64-bit word
+ *
+ *        The upper 32 bits hold the bit pattern of a 32-bit total value and the lower 32 bits hold the dense index of
+ *        the parent state. Packing both into one word lets concurrent writers improve a record with a single
+ *        compare-and-swap, so readers never observe a value paired with the wrong parent.
+ */
+template <typename ValueT> struct AtomicRecord
+{
+  static_assert(
+    std::is_arithmetic<ValueT>() and sizeof(ValueT) == sizeof(std::uint32_t),
+    MMPL_STATIC_ASSERT_MSG("ValueT must be a 32-bit arithmetic type to be packed into an atomic record"));
+
+  /// Packed word of a record which has not been set
+  static constexpr std::uint64_t EMPTY = ~std::uint64_t{0};
+
+  /**
+   * @brief Packs a value and parent index into a record word
+   */
+  static inline std::uint64_t pack(const ValueT value, const std::uint32_t parent_index)
+  {
+    std::uint32_t value_bits;
+    std::memcpy(&value_bits, &value, sizeof(value_bits));
+    return (static_cast<std::uint64_t>(value_bits) << 32) | parent_index;
+  }
+
+  /**
+   * @brief Returns value held in a (non-empty) record word
+   */
+  static inline ValueT value(const std::uint64_t word)
+  {
+    const std::uint32_t value_bits = static_cast<std::uint32_t>(word >> 32);
+    ValueT value;
+    std::memcpy(&value, &value_bits, sizeof(value));
+    return value;
+  }
+
+  /**
+   * @brief Returns parent index held in a (non-empty) record word
+   */
+  static inline std::uint32_t parent_index(const std::uint64_t word) { return static_cast<std::uint32_t>(word); }
+
+  /**
+   * @brief Sets an empty record
+   *
+   * @retval true  if record was empty and is now set
+   * @retval false  if record was already set
+   */
+  static inline bool try_set(std::atomic<std::uint64_t>& record, const ValueT value, const std::uint32_t parent_index)
+  {
+    std::uint64_t expected = EMPTY;
+    return record.compare_exchange_strong(expected, pack(value, parent_index), std::memory_order_acq_rel);
+  }
+
+  /**
+   * @brief Sets an empty record, or lowers the value of a set record
+   *
+   * @retval true  if record was empty or held a greater value, and now holds <code>value</code>
+   * @retval false  otherwise
+   */
+  static inline bool
+  try_improve(std::atomic<std::uint64_t>& record, const ValueT value, const std::uint32_t parent_index)
+  {
+    const std::uint64_t desired = pack(value, parent_index);
+    std::uint64_t expected = record.load(std::memory_order_acquire);
+    do
+    {
+      if (expected != EMPTY and !(value < AtomicRecord::value(expected)))
+      {
+        return false;
+      }
+    } while (!record.compare_exchange_weak(expected, desired, std::memory_order_acq_rel, std::memory_order_acquire));
+    return true;
+  }
+};
+
+}  // namespace mmpl::expansion_table
+
+#endif  // MMPL_EXPANSION_TABLE_ATOMIC_RECORD_H
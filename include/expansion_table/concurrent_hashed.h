@@ -0,0 +1,299 @@
+#ifndef MMPL_EXPANSION_TABLE_CONCURRENT_HASHED_H
+#define MMPL_EXPANSION_TABLE_CONCURRENT_HASHED_H
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/expansion_table/atomic_record.h>
+#include <mmpl/state.h>
+#include <mmpl/support.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Thread-safe, lock-free expansion table over arbitrary hashable states
+ *
+ *        Counterpart of expansion_table::DenseAtomic for states without dense IDs. States are kept in a fixed-size,
+ *        linearly-probed open-addressing table. Each slot holds:
+ *        - a key word, which a thread claims with a single compare-and-swap (empty to claimed), before copying the
+ *          state into the slot and publishing it (claimed to ready)
+ *        - an AtomicRecord, packing the total value together with the slot index of the parent state, which is set
+ *          and improved by compare-and-swap
+ *
+ *        <code>expand</code>, <code>relax</code>, <code>is_expanded</code>, <code>get_parent</code> and
+ *        <code>get_total_value</code> may be called concurrently; <code>reset</code> may not. Lookups never wait: a
+ *        state which is still being claimed has no record yet, so it is reported as not expanded. A thread inserting a
+ *        state which another thread is in the middle of claiming waits for that single state copy to be published.
+ *
+ *        Key words hold hash bits of their state, so probes only compare states whose hashes match.
+ *
+ * @note Slots are never freed until <code>reset</code>, and the table does not grow; it must be constructed with
+ *       enough capacity for every state (parents included) touched by a search
+ */
+template <typename StateT, typename ValueT, typename HashT = state_default_hash_t<StateT>>
+class ConcurrentHashed : public ExpansionTableBase<ConcurrentHashed<StateT, ValueT, HashT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param capacity  maximum number of distinct states held by the table
+   * @param hash  state hash function
+   */
+  explicit ConcurrentHashed(const std::size_t capacity, HashT hash = HashT{}) : hash_{std::move(hash)}
+  {
+    // Keep table at most half full, so probe sequences stay short
+    std::size_t slot_count = 2;
+    while (slot_count < 2 * capacity)
+    {
+      slot_count *= 2;
+    }
+    MMPL_RUNTIME_ASSERT(slot_count <= std::numeric_limits<std::uint32_t>::max());
+
+    mask_ = slot_count - 1;
+    keys_.reset(new std::atomic<std::uint64_t>[slot_count]);
+    records_.reset(new std::atomic<std::uint64_t>[slot_count]);
+    states_.reset(new StateStorage[slot_count]);
+    for (std::size_t slot = 0; slot <= mask_; ++slot)
+    {
+      keys_[slot].store(EMPTY_KEY, std::memory_order_relaxed);
+      records_[slot].store(RecordType::EMPTY, std::memory_order_relaxed);
+    }
+    size_.store(0, std::memory_order_release);
+  }
+
+  ConcurrentHashed(const ConcurrentHashed&) = delete;
+
+  ~ConcurrentHashed() { reset_impl(); }
+
+  /**
+   * @brief Returns number of distinct states held by the table
+   */
+  inline std::size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Returns maximum number of distinct states the table may hold
+   */
+  inline std::size_t capacity() const { return (mask_ + 1) / 2; }
+
+private:
+  using RecordType = AtomicRecord<ValueT>;
+
+  /// Uninitialized storage for a single state, constructed when its slot is claimed
+  using StateStorage = std::aligned_storage_t<sizeof(StateT), alignof(StateT)>;
+
+  /// Key word of a slot which has not been claimed
+  static constexpr std::uint64_t EMPTY_KEY = 0;
+
+  /// Key status bit set while a slot is claimed, but its state is not yet published
+  static constexpr std::uint64_t CLAIMED = 1;
+
+  /// Key status bit set once the state of a slot is published
+  static constexpr std::uint64_t READY = 2;
+
+  /// Mask of key status bits
+  static constexpr std::uint64_t STATUS_MASK = CLAIMED | READY;
+
+  /// Slot index which refers to no slot
+  static constexpr std::size_t NO_SLOT = std::numeric_limits<std::size_t>::max();
+
+  /**
+   * @brief Returns key word hash bits of a state hash
+   */
+  static constexpr std::uint64_t tag(const std::size_t hash)
+  {
+    return (static_cast<std::uint64_t>(hash) << 2) & ~STATUS_MASK;
+  }
+
+  /**
+   * @brief Returns first probe slot for a state hash
+   */
+  inline std::size_t home(const std::size_t hash) const
+  {
+    // Fibonacci hashing spreads sequential IDs (e.g. grid cells) over the whole table
+    return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32) & mask_;
+  }
+
+  /**
+   * @brief Returns state held in a claimed slot
+   */
+  inline const StateT& state(const std::size_t slot) const
+  {
+    return *std::launder(reinterpret_cast<const StateT*>(&states_[slot]));
+  }
+
+  /**
+   * @brief Returns slot holding a published <code>query</code> state; NO_SLOT if there is none
+   */
+  inline std::size_t find(const StateT& query) const
+  {
+    const std::size_t hash = hash_(query);
+    const std::uint64_t query_tag = tag(hash);
+    for (std::size_t slot = home(hash), probes = 0; probes <= mask_; slot = (slot + 1) & mask_, ++probes)
+    {
+      const std::uint64_t key = keys_[slot].load(std::memory_order_acquire);
+      if (key == EMPTY_KEY)
+      {
+        return NO_SLOT;
+      }
+      else if (key == (query_tag | READY) and state(slot) == query)
+      {
+        return slot;
+      }
+    }
+    return NO_SLOT;
+  }
+
+  /**
+   * @brief Returns slot holding <code>state</code>, claiming and publishing a new slot if there is none
+   */
+  inline std::size_t insert(const StateT& state)
+  {
+    const std::size_t hash = hash_(state);
+    const std::uint64_t state_tag = tag(hash);
+    for (std::size_t slot = home(hash), probes = 0;; slot = (slot + 1) & mask_, ++probes)
+    {
+      // Table must never fill up, see class note
+      MMPL_RUNTIME_ASSERT(probes <= mask_);
+
+      std::uint64_t key = keys_[slot].load(std::memory_order_acquire);
+      if (key == EMPTY_KEY)
+      {
+        if (keys_[slot].compare_exchange_strong(key, state_tag | CLAIMED, std::memory_order_acq_rel))
+        {
+          new (&states_[slot]) StateT{state};
+          keys_[slot].store(state_tag | READY, std::memory_order_release);
+          size_.fetch_add(1, std::memory_order_relaxed);
+          return slot;
+        }
+        // Lost the claim; key now holds the winning key word
+      }
+
+      if ((key & ~STATUS_MASK) != state_tag)
+      {
+        continue;
+      }
+
+      // Wait for a concurrently claimed state with matching hash bits to be published before comparing
+      while (key & CLAIMED)
+      {
+        key = keys_[slot].load(std::memory_order_acquire);
+      }
+      if (this->state(slot) == state)
+      {
+        return slot;
+      }
+    }
+  }
+
+  /**
+   * @brief Returns record word of <code>query</code>; RecordType::EMPTY if it was not expanded
+   */
+  inline std::uint64_t load_record(const StateT& query) const
+  {
+    const std::size_t slot = find(query);
+    return (slot == NO_SLOT) ? RecordType::EMPTY : records_[slot].load(std::memory_order_acquire);
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl()
+  {
+    for (std::size_t slot = 0; slot <= mask_; ++slot)
+    {
+      if constexpr (!std::is_trivially_destructible<StateT>())
+      {
+        if (keys_[slot].load(std::memory_order_relaxed) != EMPTY_KEY)
+        {
+          std::launder(reinterpret_cast<StateT*>(&states_[slot]))->~StateT();
+        }
+      }
+      keys_[slot].store(EMPTY_KEY, std::memory_order_relaxed);
+      records_[slot].store(RecordType::EMPTY, std::memory_order_relaxed);
+    }
+    size_.store(0, std::memory_order_release);
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    const auto parent_slot = static_cast<std::uint32_t>(insert(parent));
+    return RecordType::try_set(records_[insert(child)], total_value, parent_slot);
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    const auto parent_slot = static_cast<std::uint32_t>(insert(parent));
+    return RecordType::try_improve(records_[insert(child)], total_value, parent_slot);
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateT& query) const { return load_record(query) != RecordType::EMPTY; }
+
+  /**
+   * @copydoc ExpansionTableBase::get_parent
+   */
+  inline StateT get_parent_impl(const StateT& query) const
+  {
+    return state(RecordType::parent_index(load_record(query)));
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueT get_total_value_impl(const StateT& query) const { return RecordType::value(load_record(query)); }
+
+  /// State hash function
+  HashT hash_;
+
+  /// Slot index mask; one less than the number of slots
+  std::size_t mask_;
+
+  /// Number of claimed slots
+  std::atomic<std::size_t> size_;
+
+  /// Per-slot key words: state hash bits and claim status
+  std::unique_ptr<std::atomic<std::uint64_t>[]> keys_;
+
+  /// Per-slot packed (value, parent slot) records
+  std::unique_ptr<std::atomic<std::uint64_t>[]> records_;
+
+  /// Per-slot states; valid once the key of their slot is published
+  std::unique_ptr<StateStorage[]> states_;
+
+  friend class ExpansionTableBase<ConcurrentHashed<StateT, ValueT, HashT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename HashT>
+struct ExpansionTableTraits<expansion_table::ConcurrentHashed<StateT, ValueT, HashT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_CONCURRENT_HASHED_H
@@ -0,0 +1,124 @@
+#ifndef MMPL_EXPANSION_TABLE_DENSE_ATOMIC_H
+#define MMPL_EXPANSION_TABLE_DENSE_ATOMIC_H
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/expansion_table/atomic_record.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Thread-safe expansion table over states with dense IDs
+ *
+ *        Holds one AtomicRecord per state, addressed by <code>state.id()</code>. <code>expand</code>,
+ *        <code>relax</code>, <code>is_expanded</code>, <code>get_parent</code> and <code>get_total_value</code> may
+ *        be called concurrently; <code>reset</code> may not.
+ *
+ *        <code>IndexerT</code> maps dense IDs back to states and must provide:
+ *        - <code>std::size_t size() const</code>, one past the largest state ID
+ *        - <code>StateT state(std::uint32_t id) const</code>
+ *
+ *        (e.g. grid::Layout, state_space::CsrGraph)
+ *
+ * @warn Referenced indexer must outlive this object
+ */
+template <typename StateT, typename ValueT, typename IndexerT>
+class DenseAtomic : public ExpansionTableBase<DenseAtomic<StateT, ValueT, IndexerT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param indexer  maps dense state IDs to states
+   */
+  explicit DenseAtomic(const IndexerT& indexer) :
+      indexer_{std::addressof(indexer)},
+      records_{new std::atomic<std::uint64_t>[indexer.size()]}
+  {
+    reset_impl();
+  }
+
+private:
+  using RecordType = AtomicRecord<ValueT>;
+
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl()
+  {
+    for (std::size_t i = 0; i < indexer_->size(); ++i)
+    {
+      records_[i].store(RecordType::EMPTY, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    return RecordType::try_set(records_[child.id()], total_value, parent.id());
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    return RecordType::try_improve(records_[child.id()], total_value, parent.id());
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateT& query) const
+  {
+    return records_[query.id()].load(std::memory_order_acquire) != RecordType::EMPTY;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::get_parent
+   */
+  inline StateT get_parent_impl(const StateT& query) const
+  {
+    return indexer_->state(RecordType::parent_index(records_[query.id()].load(std::memory_order_acquire)));
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueT get_total_value_impl(const StateT& query) const
+  {
+    return RecordType::value(records_[query.id()].load(std::memory_order_acquire));
+  }
+
+  /// Maps dense IDs to states
+  const IndexerT* indexer_;
+
+  /// Per-state packed (value, parent index) records
+  std::unique_ptr<std::atomic<std::uint64_t>[]> records_;
+
+  friend class ExpansionTableBase<DenseAtomic<StateT, ValueT, IndexerT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename IndexerT>
+struct ExpansionTableTraits<expansion_table::DenseAtomic<StateT, ValueT, IndexerT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_DENSE_ATOMIC_H
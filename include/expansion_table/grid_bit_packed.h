@@ -0,0 +1,187 @@
+#ifndef MMPL_EXPANSION_TABLE_GRID_BIT_PACKED_H
+#define MMPL_EXPANSION_TABLE_GRID_BIT_PACKED_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/grid/bitmap.h>
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/layout.h>
+#include <mmpl/grid/neighborhood.h>
+#include <mmpl/grid/occupancy.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Bit-packed expansion table for unit-cost searches over 8-connected 2D grids
+ *
+ *        Stores a 1-bit visited plane and a 4-bit direction-to-parent plane over a grid::Layout, or roughly five bits
+ *        per cell; search roots are marked with a reserved direction code. Total values are not stored; they are
+ *        recovered as the number of steps back to a search root.
+ *        Records are never improved after being set, which is exact for breadth-first expansion of unit-cost moves.
+ */
+template <typename ValueT> class GridBitPacked : public ExpansionTableBase<GridBitPacked<ValueT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param layout  layout of grid being searched
+   */
+  explicit GridBitPacked(const grid::Layout<2>& layout) :
+      layout_{layout},
+      visited_{layout.size()},
+      directions_(layout.size() / CODES_PER_WORD + 1, 0)
+  {}
+
+  /**
+   * @brief Returns mask of neighbors of <code>cell</code> which are both free and not yet expanded
+   *
+   *        Bit <code>i</code> of the result corresponds to direction code <code>i</code> of
+   *        <code>grid::Neighborhood<2, 8></code>. Computed with word-level operations on the occupancy and visited
+   *        bit planes.
+   *
+   * @param occupancy  occupancy grid with the same layout as this table
+   * @param cell  in-bounds query cell
+   */
+  inline std::uint8_t unexpanded_free_neighbors(const grid::Occupancy<2>& occupancy, const grid::Cell<2>& cell) const
+  {
+    const std::uint32_t row_stride = layout_.stride(1);
+    return static_cast<std::uint8_t>(~(
+      grid::neighbor_mask(occupancy.bitmap(), cell.index(), row_stride) |
+      grid::neighbor_mask(visited_, cell.index(), row_stride)));
+  }
+
+private:
+  using NeighborhoodType = grid::Neighborhood<2, 8>;
+
+  /// Number of 4-bit direction codes packed into each word
+  static constexpr std::uint32_t CODES_PER_WORD = 16;
+
+  /// Direction code reserved for search roots, following the eight neighbor direction codes
+  static constexpr std::uint8_t ROOT_CODE = NeighborhoodType::offsets.size();
+
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl() { visited_.clear(); }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool
+  expand_impl(const grid::Cell<2>& parent, const grid::Cell<2>& child, [[maybe_unused]] const ValueT& total_value)
+  {
+    if (visited_.test(child.index()))
+    {
+      return false;
+    }
+
+    visited_.set(child.index());
+
+    if (parent == child)
+    {
+      set_direction(child.index(), ROOT_CODE);
+    }
+    else
+    {
+      const grid::Coordinates<2> delta{parent[0] - child[0], parent[1] - child[1]};
+      MMPL_RUNTIME_ASSERT(std::max(std::abs(delta[0]), std::abs(delta[1])) == 1);
+      set_direction(child.index(), NeighborhoodType::code(delta));
+    }
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   *
+   * @note Records are write-once; equivalent to <code>expand</code>
+   */
+  inline bool relax_impl(const grid::Cell<2>& parent, const grid::Cell<2>& child, const ValueT& total_value)
+  {
+    return expand_impl(parent, child, total_value);
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const grid::Cell<2>& query) const { return visited_.test(query.index()); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_parent
+   */
+  inline grid::Cell<2> get_parent_impl(const grid::Cell<2>& query) const
+  {
+    const std::uint8_t code = get_direction(query.index());
+    return (code == ROOT_CODE) ? query : layout_.neighbor(query, NeighborhoodType::offsets[code]);
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   *
+   * @note Computed by walking parent directions back to a root; linear in path length
+   */
+  inline ValueT get_total_value_impl(const grid::Cell<2>& query) const
+  {
+    ValueT total_value = Null<ValueT>::value;
+    grid::Cell<2> current = query;
+    for (std::uint8_t code = get_direction(current.index()); code != ROOT_CODE; code = get_direction(current.index()))
+    {
+      current = layout_.neighbor(current, NeighborhoodType::offsets[code]);
+      total_value += static_cast<ValueT>(1);
+    }
+    return total_value;
+  }
+
+  /**
+   * @brief Returns direction code from cell with linear <code>index</code> to its parent
+   */
+  inline std::uint8_t get_direction(const std::uint32_t index) const
+  {
+    const std::uint32_t shift = 4 * (index % CODES_PER_WORD);
+    return static_cast<std::uint8_t>((directions_[index / CODES_PER_WORD] >> shift) & 0xF);
+  }
+
+  /**
+   * @brief Sets direction code from cell with linear <code>index</code> to its parent
+   */
+  inline void set_direction(const std::uint32_t index, const std::uint8_t code)
+  {
+    const std::uint32_t shift = 4 * (index % CODES_PER_WORD);
+    std::uint64_t& word = directions_[index / CODES_PER_WORD];
+    word = (word & ~(std::uint64_t{0xF} << shift)) | (std::uint64_t{code} << shift);
+  }
+
+  /// Layout of grid being searched
+  grid::Layout<2> layout_;
+
+  /// Visited cell bits
+  grid::Bitmap visited_;
+
+  /// Packed 4-bit direction codes to parent cells, or ROOT_CODE for search roots
+  std::vector<std::uint64_t> directions_;
+
+  friend class ExpansionTableBase<GridBitPacked<ValueT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename ValueT> struct ExpansionTableTraits<expansion_table::GridBitPacked<ValueT>>
+{
+  using StateType = grid::Cell<2>;
+  using ValueType = ValueT;
+  static constexpr bool is_write_once = true;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_GRID_BIT_PACKED_H
@@ -0,0 +1,181 @@
+#ifndef MMPL_EXPANSION_TABLE_INTERNED_H
+#define MMPL_EXPANSION_TABLE_INTERNED_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/state_pool.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Expansion table which records state handles in place of states
+ *
+ *        States are interned in a StatePool, and records are held in a dense array indexed by state handle, each
+ *        holding a parent handle and total value. Unlike expansion_table::Unordered, no state is copied into the
+ *        table (parents included), and a query costs one pool probe followed by an array access.
+ *
+ *        Resetting the table clears its records but not the pool, so states keep their handles across searches; clear
+ *        the pool separately to bound its memory use.
+ *
+ * @warn Referenced state pool must outlive this object
+ */
+template <typename StateT, typename ValueT, typename HashT = state_default_hash_t<StateT>>
+class Interned : public ExpansionTableBase<Interned<StateT, ValueT, HashT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param pool  state pool; may be shared with an expansion_queue::Interned
+   */
+  explicit Interned(StatePool<StateT, HashT>& pool) : pool_{std::addressof(pool)} {}
+
+  /**
+   * @brief Returns state pool
+   */
+  inline const StatePool<StateT, HashT>& pool() const { return *pool_; }
+
+private:
+  /**
+   * @brief Per-state expansion record
+   */
+  struct Record
+  {
+    /// Predecessor state handle; NO_STATE_HANDLE if state was not expanded
+    StateHandle parent;
+
+    /// Total value accumulated up to state
+    ValueT total_value;
+  };
+
+  /**
+   * @brief Returns record of <code>query</code>; nullptr if it was not expanded
+   */
+  inline const Record* find(const StateT& query) const
+  {
+    const StateHandle handle = pool_->find(query);
+    return (handle < records_.size() and records_[handle].parent != NO_STATE_HANDLE) ? &records_[handle] : nullptr;
+  }
+
+  /**
+   * @brief Returns record of <code>handle</code>, growing record array to cover all interned states if needed
+   */
+  inline Record& get(const StateHandle handle)
+  {
+    if (handle >= records_.size())
+    {
+      records_.resize(pool_->size(), Record{NO_STATE_HANDLE, ValueT{}});
+    }
+    return records_[handle];
+  }
+
+  /**
+   * @brief Sets record of <code>child</code>
+   */
+  inline void
+  set(Record& record, const StateHandle parent, [[maybe_unused]] const StateHandle child, const ValueT& total_value)
+  {
+    MMPL_RUNTIME_ASSERT(parent == child or parent < records_.size());
+    record.parent = parent;
+    record.total_value = total_value;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl() { records_.clear(); }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    const StateHandle parent_handle = pool_->intern(parent);
+    const StateHandle child_handle = pool_->intern(child);
+    Record& record = get(child_handle);
+    if (record.parent != NO_STATE_HANDLE)
+    {
+      return false;
+    }
+    set(record, parent_handle, child_handle, total_value);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    const StateHandle parent_handle = pool_->intern(parent);
+    const StateHandle child_handle = pool_->intern(child);
+    Record& record = get(child_handle);
+    if (record.parent != NO_STATE_HANDLE and !(total_value < record.total_value))
+    {
+      return false;
+    }
+    set(record, parent_handle, child_handle, total_value);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateT& query) const { return find(query) != nullptr; }
+
+  /**
+   * @copydoc ExpansionTableBase::get_parent
+   */
+  inline StateT get_parent_impl(const StateT& query) const { return pool_->state(find(query)->parent); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueT get_total_value_impl(const StateT& query) const { return find(query)->total_value; }
+
+  /**
+   * @copydoc ExpansionTableBase::path_length
+   *
+   * @note Follows parent handles through the record array, so only <code>terminal</code> itself is looked up in the
+   *       state pool
+   */
+  inline std::size_t path_length_impl(const StateT& terminal) const
+  {
+    std::size_t length = 1;
+    for (StateHandle handle = pool_->find(terminal); records_[handle].parent != handle;
+         handle = records_[handle].parent)
+    {
+      ++length;
+    }
+    return length;
+  }
+
+  /// Interned states
+  StatePool<StateT, HashT>* pool_;
+
+  /// Expansion records, indexed by state handle
+  std::vector<Record> records_;
+
+  friend class ExpansionTableBase<Interned<StateT, ValueT, HashT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename HashT>
+struct ExpansionTableTraits<expansion_table::Interned<StateT, ValueT, HashT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_INTERNED_H
@@ -74,6 +74,22 @@ private:
     return true;
   }
 
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl(const StateType& parent, const StateType& child, const ValueType& total_value)
+  {
+    if (!underlying_.relax(parent, child, total_value))
+    {
+      return false;
+    }
+    if constexpr (FLAGS & OStreamHookOptions::ON_EXPANSION)
+    {
+      (*os_) << "relax  : " << parent << " --> " << child << ", value : " << total_value << std::endl;
+    }
+    return true;
+  }
+
   /**
    * @copydoc ExpansionTableBase::is_expanded
    */
@@ -97,6 +113,11 @@ private:
    */
   inline ValueType get_total_value_impl(const StateType& query) const { return underlying_.get_total_value(query); }
 
+  /**
+   * @copydoc ExpansionTableBase::path_length
+   */
+  inline std::size_t path_length_impl(const StateType& terminal) const { return underlying_.path_length(terminal); }
+
   /// Logger
   std::ostream* os_;
 
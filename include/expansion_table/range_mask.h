@@ -0,0 +1,180 @@
+#ifndef MMPL_EXPANSION_TABLE_RANGE_MASK_H
+#define MMPL_EXPANSION_TABLE_RANGE_MASK_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/grid/bitmap.h>
+#include <mmpl/value.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Cost-bounded dense mask of reached states, for use as the expansion table of a range query
+ *
+ *        Dense counterpart of RangeSet over states with dense IDs (e.g. grid cells): reached states are marked in a
+ *        bit mask over state IDs, with their total values in a parallel array. IDs of reached states are also listed
+ *        in order of first reach, so the reached set can be iterated without scanning the mask, and
+ *        <code>reset</code> only clears entries which were reached; repeated small queries over a large grid do not
+ *        pay for the whole grid.
+ *
+ *        <code>IndexerT</code> maps dense IDs back to states and must provide:
+ *        - <code>std::size_t size() const</code>, one past the largest state ID
+ *        - <code>StateT state(std::uint32_t id) const</code>
+ *
+ *        (e.g. grid::Layout, state_space::CsrGraph)
+ *
+ * @note Parents are not recorded, so paths cannot be extracted
+ *
+ * @warn Referenced indexer must outlive this object
+ */
+template <typename StateT, typename ValueT, typename IndexerT>
+class RangeMask : public ExpansionTableBase<RangeMask<StateT, ValueT, IndexerT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param indexer  maps dense state IDs to states
+   * @param radius  states with total value greater than this are not recorded
+   */
+  explicit RangeMask(const IndexerT& indexer, const ValueT& radius = Invalid<ValueT>::value) :
+      indexer_{std::addressof(indexer)},
+      radius_{radius},
+      mask_{indexer.size()},
+      values_(indexer.size(), Invalid<ValueT>::value)
+  {}
+
+  /**
+   * @copydoc RangeSet::set_radius
+   */
+  inline void set_radius(const ValueT& radius) { radius_ = radius; }
+
+  /**
+   * @copydoc RangeSet::radius
+   */
+  inline const ValueT& radius() const { return radius_; }
+
+  /**
+   * @brief Returns indexer mapping dense IDs to states
+   */
+  inline const IndexerT& indexer() const { return *indexer_; }
+
+  /**
+   * @brief Returns mask of reached states, indexed by state ID
+   */
+  inline const grid::Bitmap& mask() const { return mask_; }
+
+  /**
+   * @brief Returns IDs of reached states, in order of first reach
+   */
+  inline const std::vector<std::uint32_t>& ids() const { return ids_; }
+
+  /**
+   * @brief Returns total value of state with dense <code>id</code>; Invalid value if it was not reached
+   */
+  inline ValueT value(const std::uint32_t id) const { return values_[id]; }
+
+  /**
+   * @brief Returns number of reached states
+   */
+  inline std::size_t size() const { return ids_.size(); }
+
+private:
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl()
+  {
+    for (const std::uint32_t id : ids_)
+    {
+      mask_.reset(id);
+      values_[id] = Invalid<ValueT>::value;
+    }
+    ids_.clear();
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl([[maybe_unused]] const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    const std::uint32_t id = child.id();
+    if (radius_ < total_value or mask_.test(id))
+    {
+      return false;
+    }
+    mask_.set(id);
+    values_[id] = total_value;
+    ids_.push_back(id);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl([[maybe_unused]] const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    const std::uint32_t id = child.id();
+    if (radius_ < total_value or (mask_.test(id) and !(total_value < values_[id])))
+    {
+      return false;
+    }
+    else if (!mask_.test(id))
+    {
+      mask_.set(id);
+      ids_.push_back(id);
+    }
+    values_[id] = total_value;
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateT& query) const { return mask_.test(query.id()); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueT get_total_value_impl(const StateT& query) const { return values_[query.id()]; }
+
+  /// Maps dense IDs to states
+  const IndexerT* indexer_;
+
+  /// Radius beyond which states are not recorded
+  ValueT radius_;
+
+  /// Reached state bits
+  grid::Bitmap mask_;
+
+  /// Per-state total values
+  std::vector<ValueT> values_;
+
+  /// IDs of reached states
+  std::vector<std::uint32_t> ids_;
+
+  friend class ExpansionTableBase<RangeMask<StateT, ValueT, IndexerT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename IndexerT>
+struct ExpansionTableTraits<expansion_table::RangeMask<StateT, ValueT, IndexerT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_RANGE_MASK_H
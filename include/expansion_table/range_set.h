@@ -0,0 +1,145 @@
+#ifndef MMPL_EXPANSION_TABLE_RANGE_SET_H
+#define MMPL_EXPANSION_TABLE_RANGE_SET_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_queue.h>
+#include <mmpl/expansion_table.h>
+#include <mmpl/state.h>
+#include <mmpl/value.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Cost-bounded set of reached states, for use as the expansion table of a range query
+ *
+ *        Records only the states reached with a total value no greater than a radius, along with their values, in a
+ *        compact array which may be iterated directly as <code>StateValue</code> entries (in order of first reach).
+ *        States beyond the radius are rejected by <code>expand</code> and <code>relax</code>, so they are never
+ *        enqueued either; searches using this table stop once everything within the radius was expanded.
+ *
+ * @note Parents are not recorded, so paths cannot be extracted; use a full expansion table with
+ *       <code>run_multi_source</code> when paths are needed
+ */
+template <typename StateT, typename ValueT, typename HashT = state_default_hash_t<StateT>>
+class RangeSet : public ExpansionTableBase<RangeSet<StateT, ValueT, HashT>>
+{
+public:
+  using const_iterator = typename std::vector<StateValue<StateT, ValueT>>::const_iterator;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param radius  states with total value greater than this are not recorded
+   */
+  explicit RangeSet(const ValueT& radius = Invalid<ValueT>::value) : radius_{radius} {}
+
+  /**
+   * @brief Sets radius; takes effect for states recorded after this call
+   */
+  inline void set_radius(const ValueT& radius) { radius_ = radius; }
+
+  /**
+   * @brief Returns radius
+   */
+  inline const ValueT& radius() const { return radius_; }
+
+  /**
+   * @brief Returns number of reached states
+   */
+  inline std::size_t size() const { return entries_.size(); }
+
+  inline const_iterator begin() const { return entries_.begin(); }
+
+  inline const_iterator end() const { return entries_.end(); }
+
+private:
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl()
+  {
+    index_.clear();
+    entries_.clear();
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl([[maybe_unused]] const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    if (radius_ < total_value or !index_.emplace(child, static_cast<std::uint32_t>(entries_.size())).second)
+    {
+      return false;
+    }
+    entries_.emplace_back(child, total_value);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl([[maybe_unused]] const StateT& parent, const StateT& child, const ValueT& total_value)
+  {
+    if (radius_ < total_value)
+    {
+      return false;
+    }
+
+    const auto [itr, inserted] = index_.emplace(child, static_cast<std::uint32_t>(entries_.size()));
+    if (inserted)
+    {
+      entries_.emplace_back(child, total_value);
+      return true;
+    }
+    else if (total_value < entries_[itr->second].value)
+    {
+      entries_[itr->second].value = total_value;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateT& query) const { return index_.find(query) != index_.end(); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueT get_total_value_impl(const StateT& query) const { return entries_[index_.find(query)->second].value; }
+
+  /// Radius beyond which states are not recorded
+  ValueT radius_;
+
+  /// [state, entry index] mapping
+  std::unordered_map<StateT, std::uint32_t, HashT> index_;
+
+  /// Reached states and their total values
+  std::vector<StateValue<StateT, ValueT>> entries_;
+
+  friend class ExpansionTableBase<RangeSet<StateT, ValueT, HashT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename StateT, typename ValueT, typename HashT>
+struct ExpansionTableTraits<expansion_table::RangeSet<StateT, ValueT, HashT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_RANGE_SET_H
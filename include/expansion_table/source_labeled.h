@@ -0,0 +1,182 @@
+#ifndef MMPL_EXPANSION_TABLE_SOURCE_LABELED_H
+#define MMPL_EXPANSION_TABLE_SOURCE_LABELED_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Expansion table wrapper which records the search source from which each state was reached
+ *
+ *        Sources are registered with <code>set_sources</code>, e.g. by <code>run_multi_source</code>, and labeled by
+ *        their index in the given sequence. Every other state takes the label of its parent whenever it is expanded or
+ *        relaxed. Labels are kept in a dense array indexed by state ID, next to the underlying table, so recording and
+ *        querying a label costs one array access.
+ *
+ *        After an exhaustive multi-source search, labels therefore describe a geodesic Voronoi partition of the state
+ *        space, i.e. the nearest source of each reached state.
+ *
+ * @note State IDs should be dense indices, e.g. those of grid::Cell or state_space::CSR vertices; the label array
+ *       grows to the largest ID reached
+ * @note A label is copied from the parent at the time the state is expanded or relaxed, and is exact if the parent's
+ *       own label is final by then, as for any search which expands states in order of total value
+ */
+template <typename UnderlyingT> class SourceLabeled : public ExpansionTableBase<SourceLabeled<UnderlyingT>>
+{
+public:
+  using StateType = expansion_table_state_t<UnderlyingT>;
+  using ValueType = expansion_table_value_t<UnderlyingT>;
+
+  /// Source label type
+  using LabelType = std::uint32_t;
+
+  /// Label returned for states which have not been reached, or were reached from an unregistered root
+  static constexpr LabelType NO_SOURCE = std::numeric_limits<LabelType>::max();
+
+  explicit SourceLabeled(UnderlyingT&& underlying = UnderlyingT{}) : underlying_{std::move(underlying)} {}
+
+  /**
+   * @brief Returns label of the source from which <code>query</code> was reached; NO_SOURCE if not reached
+   */
+  inline LabelType source(const StateType& query) const
+  {
+    const auto index = static_cast<std::size_t>(query.id());
+    return (index < labels_.size()) ? labels_[index] : NO_SOURCE;
+  }
+
+  /**
+   * @brief Returns number of registered sources, duplicates included
+   */
+  inline LabelType source_count() const { return source_count_; }
+
+  /**
+   * @brief Returns underlying expansion table
+   */
+  inline const UnderlyingT& underlying() const { return underlying_; }
+
+private:
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl()
+  {
+    underlying_.reset();
+    std::fill(labels_.begin(), labels_.end(), NO_SOURCE);
+    source_count_ = 0;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::set_sources
+   *
+   * @note Sources which appear more than once keep the label of their first occurrence
+   */
+  template <typename StateIteratorT> inline void set_sources_impl(StateIteratorT first, StateIteratorT last)
+  {
+    std::fill(labels_.begin(), labels_.end(), NO_SOURCE);
+    source_count_ = 0;
+    for (; first != last; ++first, ++source_count_)
+    {
+      auto& label = label_of(*first);
+      if (label == NO_SOURCE)
+      {
+        label = source_count_;
+      }
+    }
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl(const StateType& parent, const StateType& child, const ValueType& total_value)
+  {
+    if (!underlying_.expand(parent, child, total_value))
+    {
+      return false;
+    }
+    else if (!(parent == child))
+    {
+      label_of(child) = source(parent);
+    }
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl(const StateType& parent, const StateType& child, const ValueType& total_value)
+  {
+    if (!underlying_.relax(parent, child, total_value))
+    {
+      return false;
+    }
+    label_of(child) = source(parent);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateType& query) const { return underlying_.is_expanded(query); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_parent
+   */
+  inline StateType get_parent_impl(const StateType& query) const { return underlying_.get_parent(query); }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueType get_total_value_impl(const StateType& query) const { return underlying_.get_total_value(query); }
+
+  /**
+   * @copydoc ExpansionTableBase::path_length
+   */
+  inline std::size_t path_length_impl(const StateType& terminal) const { return underlying_.path_length(terminal); }
+
+  /**
+   * @brief Returns label slot of <code>state</code>, growing the label array to cover it
+   */
+  inline LabelType& label_of(const StateType& state)
+  {
+    const auto index = static_cast<std::size_t>(state.id());
+    if (index >= labels_.size())
+    {
+      labels_.resize(std::max(index + 1, 2 * labels_.size()), NO_SOURCE);
+    }
+    return labels_[index];
+  }
+
+  /// Source labels, indexed by state ID
+  std::vector<LabelType> labels_;
+
+  /// Number of registered sources
+  LabelType source_count_ = 0;
+
+  /// Underlying expansion table
+  UnderlyingT underlying_;
+
+  friend class ExpansionTableBase<SourceLabeled<UnderlyingT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename UnderlyingT>
+struct ExpansionTableTraits<expansion_table::SourceLabeled<UnderlyingT>> : ExpansionTableTraits<UnderlyingT>
+{};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_SOURCE_LABELED_H
@@ -2,6 +2,8 @@
 #define MMPL_EXPANSION_TABLE_UNORDERED_H
 
 // C++ Standard Library
+#include <cstddef>
+#include <iterator>
 #include <unordered_map>
 
 // MMPL
@@ -11,52 +13,107 @@ namespace mmpl::expansion_table
 {
 
 /**
- * @brief Expansion table based on a min-sorted <code>std::unordered_map</code> for hash-based state access
+ * @brief Expansion table based on a <code>std::unordered_map</code> for hash-based state access
+ *
+ *        Parent and total value of each state are held in a single map entry, so that every query is answered with
+ *        one hash probe
  */
 template <typename StateT, typename ValueT>
 class Unordered : public ExpansionTableBase<Unordered<StateT, ValueT>>
 {
-private:
+public:
   /**
-   * @copydoc ExpansionTableBase::reset
+   * @brief Calls <code>record_fn(state, parent, total_value)</code> on every expanded state
+   */
+  template <typename RecordFnT> inline void for_each(RecordFnT&& record_fn) const
+  {
+    for (const auto& [state, record] : table_)
+    {
+      record_fn(state, record.parent, record.total_value);
+    }
+  }
+
+  /**
+   * @brief Removes records of every expanded state for which <code>pred(state)</code> is true
+   *
+   *        Used to resume a search after part of its search space changed. Remaining records must not have removed
+   *        parents for paths to be extracted through them.
+   *
+   * @return number of removed records
    */
-  inline void reset_impl()
+  template <typename UnaryPredicateT> inline std::size_t erase_if(UnaryPredicateT&& pred)
   {
-    child_parent_table_.clear();
-    child_cost_table_.clear();
+    const std::size_t size = table_.size();
+    for (auto itr = table_.begin(); itr != table_.end();)
+    {
+      itr = pred(itr->first) ? table_.erase(itr) : std::next(itr);
+    }
+    return size - table_.size();
   }
 
+private:
+  /**
+   * @brief Per-state expansion record
+   */
+  struct Record
+  {
+    /// Predecessor state
+    StateT parent;
+
+    /// Total value accumulated up to state
+    ValueT total_value;
+  };
+
+  using TableType = std::unordered_map<StateT, Record, state_default_hash_t<StateT>>;
+
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl() { table_.clear(); }
+
   /**
    * @copydoc ExpansionTableBase::expand
    */
   inline bool expand_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
   {
-    return child_parent_table_.emplace(child, parent).second and child_cost_table_.emplace(child, total_value).second;
+    return table_.emplace(child, Record{parent, total_value}).second;
   }
 
   /**
-   * @copydoc ExpansionTableBase::is_expanded
+   * @copydoc ExpansionTableBase::relax
    */
-  inline bool is_expanded_impl(const StateT& query) const
+  inline bool relax_impl(const StateT& parent, const StateT& child, const ValueT& total_value)
   {
-    return child_parent_table_.find(query) != child_parent_table_.end();
+    const auto [itr, inserted] = table_.emplace(child, Record{parent, total_value});
+    if (inserted)
+    {
+      return true;
+    }
+    else if (total_value < itr->second.total_value)
+    {
+      itr->second = Record{parent, total_value};
+      return true;
+    }
+    return false;
   }
 
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const StateT& query) const { return table_.find(query) != table_.end(); }
+
   /**
    * @copydoc ExpansionTableBase::get_parent
    */
-  inline StateT get_parent_impl(const StateT& query) const { return child_parent_table_.find(query)->second; }
+  inline StateT get_parent_impl(const StateT& query) const { return table_.find(query)->second.parent; }
 
   /**
    * @copydoc ExpansionTableBase::get_total_value
    */
-  inline ValueT get_total_value_impl(const StateT& query) const { return child_cost_table_.find(query)->second; }
-
-  /// [child, total_cost] mapping
-  std::unordered_map<StateT, ValueT, state_default_hash_t<StateT>> child_cost_table_;
+  inline ValueT get_total_value_impl(const StateT& query) const { return table_.find(query)->second.total_value; }
 
-  /// [child, parent] mapping
-  std::unordered_map<StateT, StateT, state_default_hash_t<StateT>> child_parent_table_;
+  /// [child, record] mapping
+  TableType table_;
 
   friend class ExpansionTableBase<expansion_table::Unordered<StateT, ValueT>>;
 };
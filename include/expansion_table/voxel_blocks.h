@@ -0,0 +1,227 @@
+#ifndef MMPL_EXPANSION_TABLE_VOXEL_BLOCKS_H
+#define MMPL_EXPANSION_TABLE_VOXEL_BLOCKS_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/grid/neighborhood.h>
+#include <mmpl/grid/voxel_map.h>
+#include <mmpl/value.h>
+
+namespace mmpl::expansion_table
+{
+
+/**
+ * @brief Expansion table over sparse voxel grids, organized in the same 8x8x8 blocks as grid::VoxelBlockMap
+ *
+ *        Records are allocated a whole block at a time, on first expansion of a voxel in that block, and kept
+ *        contiguous in a single array; a block holds a total value and a one-byte direction code to the parent voxel
+ *        for each of its voxels. Since most children of a voxel lie in the same block, the block of the last access
+ *        is cached, and most queries cost no hash lookup at all.
+ *
+ *        Parents must be neighbors of their children under <code>grid::Neighborhood<3, 26></code> (or the children
+ *        themselves, for search roots), as generated by state_space::SparseVoxelGrid.
+ */
+template <typename ValueT> class VoxelBlocks : public ExpansionTableBase<VoxelBlocks<ValueT>>
+{
+public:
+  /**
+   * @brief Returns number of allocated record blocks
+   */
+  inline std::size_t block_count() const { return blocks_.size(); }
+
+private:
+  using NeighborhoodType = grid::Neighborhood<3, 26>;
+
+  /// Direction code of voxels without a record
+  static constexpr std::uint8_t UNSET = std::numeric_limits<std::uint8_t>::max();
+
+  /// Direction code of search roots
+  static constexpr std::uint8_t ROOT = 26;
+
+  /// Block index of a missing block
+  static constexpr std::uint32_t NO_BLOCK = std::numeric_limits<std::uint32_t>::max();
+
+  /// Cached block key of an empty cache
+  static constexpr std::uint64_t NO_KEY = std::numeric_limits<std::uint64_t>::max();
+
+  /**
+   * @brief Per-block expansion records
+   */
+  struct Block
+  {
+    /// Per-voxel total values
+    std::array<ValueT, grid::VoxelBlockMap::BLOCK_VOLUME> values;
+
+    /// Per-voxel direction codes to parent voxels
+    std::array<std::uint8_t, grid::VoxelBlockMap::BLOCK_VOLUME> parents;
+  };
+
+  /**
+   * @brief Returns index of the record block holding <code>voxel</code>; NO_BLOCK if not allocated
+   */
+  inline std::uint32_t find_block(const grid::Voxel& voxel) const
+  {
+    const auto key = grid::pack_coordinates(grid::VoxelBlockMap::block_coordinates(voxel.coordinates()));
+    if (key != last_key_)
+    {
+      const auto itr = block_index_.find(key);
+      if (itr == block_index_.end())
+      {
+        return NO_BLOCK;
+      }
+      last_key_ = key;
+      last_block_ = itr->second;
+    }
+    return last_block_;
+  }
+
+  /**
+   * @brief Returns record block holding <code>voxel</code>, allocating it if needed
+   */
+  inline Block& get_block(const grid::Voxel& voxel)
+  {
+    const auto key = grid::pack_coordinates(grid::VoxelBlockMap::block_coordinates(voxel.coordinates()));
+    if (key != last_key_)
+    {
+      const auto [itr, inserted] = block_index_.emplace(key, static_cast<std::uint32_t>(blocks_.size()));
+      if (inserted)
+      {
+        blocks_.emplace_back();
+        blocks_.back().values.fill(Invalid<ValueT>::value);
+        blocks_.back().parents.fill(UNSET);
+      }
+      last_key_ = key;
+      last_block_ = itr->second;
+    }
+    return blocks_[last_block_];
+  }
+
+  /**
+   * @brief Sets record of <code>child</code> in <code>block</code>
+   */
+  static inline void set(Block& block, const grid::Voxel& parent, const grid::Voxel& child, const ValueT& total_value)
+  {
+    const std::uint32_t local = grid::VoxelBlockMap::local_index(child.coordinates());
+    block.values[local] = total_value;
+    if (parent == child)
+    {
+      block.parents[local] = ROOT;
+    }
+    else
+    {
+      const grid::Coordinates<3> delta{parent[0] - child[0], parent[1] - child[1], parent[2] - child[2]};
+      MMPL_RUNTIME_ASSERT(std::max({std::abs(delta[0]), std::abs(delta[1]), std::abs(delta[2])}) == 1);
+      block.parents[local] = NeighborhoodType::code(delta);
+    }
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::reset
+   */
+  inline void reset_impl()
+  {
+    block_index_.clear();
+    blocks_.clear();
+    last_key_ = NO_KEY;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::expand
+   */
+  inline bool expand_impl(const grid::Voxel& parent, const grid::Voxel& child, const ValueT& total_value)
+  {
+    Block& block = get_block(child);
+    if (block.parents[grid::VoxelBlockMap::local_index(child.coordinates())] != UNSET)
+    {
+      return false;
+    }
+    set(block, parent, child, total_value);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::relax
+   */
+  inline bool relax_impl(const grid::Voxel& parent, const grid::Voxel& child, const ValueT& total_value)
+  {
+    Block& block = get_block(child);
+    const std::uint32_t local = grid::VoxelBlockMap::local_index(child.coordinates());
+    if (block.parents[local] != UNSET and !(total_value < block.values[local]))
+    {
+      return false;
+    }
+    set(block, parent, child, total_value);
+    return true;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::is_expanded
+   */
+  inline bool is_expanded_impl(const grid::Voxel& query) const
+  {
+    const std::uint32_t block = find_block(query);
+    return block != NO_BLOCK and
+      blocks_[block].parents[grid::VoxelBlockMap::local_index(query.coordinates())] != UNSET;
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::get_parent
+   */
+  inline grid::Voxel get_parent_impl(const grid::Voxel& query) const
+  {
+    const std::uint8_t code = blocks_[find_block(query)].parents[grid::VoxelBlockMap::local_index(query.coordinates())];
+    if (code == ROOT)
+    {
+      return query;
+    }
+    const grid::Coordinates<3>& offset = NeighborhoodType::offsets[code];
+    return grid::Voxel{{query[0] + offset[0], query[1] + offset[1], query[2] + offset[2]}};
+  }
+
+  /**
+   * @copydoc ExpansionTableBase::get_total_value
+   */
+  inline ValueT get_total_value_impl(const grid::Voxel& query) const
+  {
+    return blocks_[find_block(query)].values[grid::VoxelBlockMap::local_index(query.coordinates())];
+  }
+
+  /// [packed block coordinates, block index] mapping
+  std::unordered_map<std::uint64_t, std::uint32_t> block_index_;
+
+  /// Record blocks
+  std::vector<Block> blocks_;
+
+  /// Key of last accessed block
+  mutable std::uint64_t last_key_ = NO_KEY;
+
+  /// Index of last accessed block
+  mutable std::uint32_t last_block_ = NO_BLOCK;
+
+  friend class ExpansionTableBase<VoxelBlocks<ValueT>>;
+};
+
+}  // namespace mmpl::expansion_table
+
+namespace mmpl
+{
+
+template <typename ValueT> struct ExpansionTableTraits<expansion_table::VoxelBlocks<ValueT>>
+{
+  using StateType = grid::Voxel;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_EXPANSION_TABLE_VOXEL_BLOCKS_H
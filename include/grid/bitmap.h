@@ -0,0 +1,144 @@
+#ifndef MMPL_GRID_BITMAP_H
+#define MMPL_GRID_BITMAP_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Word-packed bit plane over linear cell indices
+ */
+class Bitmap
+{
+public:
+  Bitmap() = default;
+
+  /**
+   * @brief Initialization constructor; all bits are initially cleared
+   *
+   * @param size  number of addressable bits
+   */
+  explicit Bitmap(const std::size_t size) : size_{size}, words_(size / 64 + 2, 0) {}
+
+  /**
+   * @brief Returns number of addressable bits
+   */
+  inline std::size_t size() const { return size_; }
+
+  /**
+   * @brief Checks if bit at <code>index</code> is set
+   */
+  inline bool test(const std::uint32_t index) const { return (words_[index >> 6] >> (index & 63)) & 1; }
+
+  /**
+   * @brief Sets bit at <code>index</code>
+   */
+  inline void set(const std::uint32_t index) { words_[index >> 6] |= (std::uint64_t{1} << (index & 63)); }
+
+  /**
+   * @brief Clears bit at <code>index</code>
+   */
+  inline void reset(const std::uint32_t index) { words_[index >> 6] &= ~(std::uint64_t{1} << (index & 63)); }
+
+  /**
+   * @brief Clears all bits
+   */
+  inline void clear() { std::fill(words_.begin(), words_.end(), 0); }
+
+  /**
+   * @brief Returns bits <code>[index - 1, index + 1]</code> packed into the three lowest bits
+   *
+   * @note Requires <code>index >= 1</code>
+   */
+  inline std::uint32_t window3(const std::uint32_t index) const
+  {
+    const std::uint32_t first = index - 1;
+    const std::uint32_t shift = first & 63;
+    const std::uint64_t* const w = words_.data() + (first >> 6);
+
+    // Split shift of the next word keeps this well-defined when shift == 0
+    return static_cast<std::uint32_t>(((w[0] >> shift) | ((w[1] << 1) << (63 - shift))) & 0x7);
+  }
+
+  /**
+   * @brief Checks if any bit in <code>[first, last)</code> is set
+   *
+   *        Scans whole words at a time, so cost is proportional to <code>(last - first) / 64</code>
+   */
+  inline bool any(const std::uint32_t first, const std::uint32_t last) const
+  {
+    if (first >= last)
+    {
+      return false;
+    }
+
+    const std::uint32_t first_word = first >> 6;
+    const std::uint32_t last_word = (last - 1) >> 6;
+    const std::uint64_t first_mask = ~std::uint64_t{0} << (first & 63);
+    const std::uint64_t last_mask = ~std::uint64_t{0} >> (63 - ((last - 1) & 63));
+
+    if (first_word == last_word)
+    {
+      return (words_[first_word] & first_mask & last_mask) != 0;
+    }
+    else if ((words_[first_word] & first_mask) != 0)
+    {
+      return true;
+    }
+
+    for (std::uint32_t w = first_word + 1; w < last_word; ++w)
+    {
+      if (words_[w] != 0)
+      {
+        return true;
+      }
+    }
+    return (words_[last_word] & last_mask) != 0;
+  }
+
+  /**
+   * @brief Returns underlying words; bit <code>i</code> is bit <code>i % 64</code> of word <code>i / 64</code>
+   */
+  inline const std::uint64_t* words() const { return words_.data(); }
+
+  /**
+   * @brief Returns number of underlying words
+   */
+  inline std::size_t word_count() const { return words_.size(); }
+
+private:
+  /// Number of addressable bits
+  std::size_t size_ = 0;
+
+  /// Packed bits, with one spare trailing word so that windows never read out of range
+  std::vector<std::uint64_t> words_;
+};
+
+
+/**
+ * @brief Returns mask of set bits in the 8-connected neighborhood of a cell on a 2D layout
+ *
+ *        Bit <code>i</code> of the result corresponds to direction code <code>i</code> of
+ *        <code>Neighborhood<2, 8></code>. Computed from three word-level window extractions rather than eight
+ *        single-bit probes.
+ *
+ * @param bitmap  bit plane indexed by layout linear indices
+ * @param index  linear index of cell; must not lie on the layout border
+ * @param row_stride  linear index stride between rows (<code>Layout<2>::stride(1)</code>)
+ */
+inline std::uint8_t neighbor_mask(const Bitmap& bitmap, const std::uint32_t index, const std::uint32_t row_stride)
+{
+  const std::uint32_t below = bitmap.window3(index - row_stride);
+  const std::uint32_t middle = bitmap.window3(index);
+  const std::uint32_t above = bitmap.window3(index + row_stride);
+  return static_cast<std::uint8_t>(below | ((middle & 0x1) << 3) | ((middle & 0x4) << 2) | (above << 5));
+}
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_BITMAP_H
@@ -0,0 +1,107 @@
+#ifndef MMPL_GRID_CELL_H
+#define MMPL_GRID_CELL_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// MMPL
+#include <mmpl/state.h>
+
+namespace mmpl::grid
+{
+
+template <std::size_t Dim> class Cell;
+
+/**
+ * @brief Integer cell coordinates (or coordinate offsets) on a <code>Dim</code>-dimensional grid
+ */
+template <std::size_t Dim> using Coordinates = std::array<std::int32_t, Dim>;
+
+}  // namespace mmpl::grid
+
+namespace mmpl
+{
+
+template <std::size_t Dim> struct StateTraits<grid::Cell<Dim>>
+{
+  using IDType = std::uint32_t;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Grid cell state
+ *
+ *        Carries cell coordinates along with the dense linear index of the cell within a grid::Layout. The linear
+ *        index is used as the state ID, so cells are only comparable when they were created from the same layout.
+ */
+template <std::size_t Dim> class Cell : public StateBase<Cell<Dim>>
+{
+public:
+  Cell() = default;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param _coordinates  cell coordinates
+   * @param _index  linear index of cell within its layout
+   */
+  constexpr Cell(const Coordinates<Dim>& _coordinates, const std::uint32_t _index) :
+      coordinates_{_coordinates},
+      index_{_index}
+  {}
+
+  /**
+   * @brief Returns cell coordinates
+   */
+  constexpr const Coordinates<Dim>& coordinates() const { return coordinates_; }
+
+  /**
+   * @brief Returns cell coordinate along dimension <code>d</code>
+   */
+  constexpr std::int32_t operator[](const std::size_t d) const { return coordinates_[d]; }
+
+  /**
+   * @brief Returns linear index of cell within its layout
+   */
+  constexpr std::uint32_t index() const { return index_; }
+
+private:
+  /// Cell coordinates
+  Coordinates<Dim> coordinates_;
+
+  /// Linear index within layout
+  std::uint32_t index_;
+
+  /**
+   * @copydoc StateBase::id
+   */
+  inline std::uint32_t id_impl() const { return index_; }
+
+  /**
+   * @copydoc StateBase::operator==
+   */
+  inline bool equals_impl(const Cell& other) const { return this->index_ == other.index_; }
+
+  friend inline std::ostream& operator<<(std::ostream& os, const Cell& cell)
+  {
+    os << '(' << cell.coordinates_[0];
+    for (std::size_t d = 1; d < Dim; ++d)
+    {
+      os << ", " << cell.coordinates_[d];
+    }
+    return os << ')';
+  }
+
+  friend class StateBase<Cell<Dim>>;
+};
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_CELL_H
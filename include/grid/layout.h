@@ -0,0 +1,152 @@
+#ifndef MMPL_GRID_LAYOUT_H
+#define MMPL_GRID_LAYOUT_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/support.h>
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Mapping between cell coordinates and dense linear cell indices
+ *
+ *        Cells are laid out with the first dimension varying fastest. The layout reserves a one-cell border around
+ *        the grid extents, so every in-bounds cell has valid neighbor indices at constant offsets from its own index.
+ *        Data indexed by the layout should mark border cells as blocked, which makes bounds checks during neighbor
+ *        enumeration unnecessary.
+ */
+template <std::size_t Dim> class Layout
+{
+public:
+  Layout() = default;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param extents  number of (in-bounds) cells along each dimension
+   */
+  explicit Layout(const Coordinates<Dim>& extents) : extents_{extents}
+  {
+    std::size_t stride = 1;
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      MMPL_RUNTIME_ASSERT(extents[d] > 0);
+      strides_[d] = static_cast<std::int32_t>(stride);
+      stride *= static_cast<std::size_t>(extents[d] + 2);
+    }
+    size_ = stride;
+  }
+
+  /**
+   * @brief Returns number of in-bounds cells along each dimension
+   */
+  constexpr const Coordinates<Dim>& extents() const { return extents_; }
+
+  /**
+   * @brief Returns total number of indexable cells, including border cells
+   */
+  constexpr std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns difference in linear index between cells one step apart along dimension <code>d</code>
+   */
+  constexpr std::int32_t stride(const std::size_t d) const { return strides_[d]; }
+
+  /**
+   * @brief Checks if cell coordinates are within grid extents
+   */
+  inline bool within(const Coordinates<Dim>& coordinates) const
+  {
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      if (coordinates[d] < 0 or coordinates[d] >= extents_[d])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Returns linear index of cell at <code>coordinates</code>
+   *
+   * @note Valid for in-bounds coordinates, and for coordinates on the one-cell border
+   */
+  inline std::uint32_t index(const Coordinates<Dim>& coordinates) const
+  {
+    std::int32_t index = 0;
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      index += (coordinates[d] + 1) * strides_[d];
+    }
+    return static_cast<std::uint32_t>(index);
+  }
+
+  /**
+   * @brief Returns difference in linear index between cells separated by <code>delta</code>
+   */
+  inline std::int32_t offset(const Coordinates<Dim>& delta) const
+  {
+    std::int32_t offset = 0;
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      offset += delta[d] * strides_[d];
+    }
+    return offset;
+  }
+
+  /**
+   * @brief Returns cell state at <code>coordinates</code>
+   */
+  inline Cell<Dim> state(const Coordinates<Dim>& coordinates) const
+  {
+    return Cell<Dim>{coordinates, index(coordinates)};
+  }
+
+  /**
+   * @brief Returns cell state with linear <code>index</code>
+   */
+  inline Cell<Dim> state(const std::uint32_t index) const
+  {
+    Coordinates<Dim> coordinates;
+    std::uint32_t remainder = index;
+    for (std::size_t d = Dim; d > 0; --d)
+    {
+      coordinates[d - 1] = static_cast<std::int32_t>(remainder / strides_[d - 1]) - 1;
+      remainder %= strides_[d - 1];
+    }
+    return Cell<Dim>{coordinates, index};
+  }
+
+  /**
+   * @brief Returns cell state offset from <code>cell</code> by <code>delta</code>
+   */
+  inline Cell<Dim> neighbor(const Cell<Dim>& cell, const Coordinates<Dim>& delta) const
+  {
+    Coordinates<Dim> coordinates = cell.coordinates();
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      coordinates[d] += delta[d];
+    }
+    return Cell<Dim>{coordinates, static_cast<std::uint32_t>(static_cast<std::int32_t>(cell.index()) + offset(delta))};
+  }
+
+private:
+  /// Number of in-bounds cells along each dimension
+  Coordinates<Dim> extents_ = {};
+
+  /// Linear index strides along each dimension
+  Coordinates<Dim> strides_ = {};
+
+  /// Total number of indexable cells
+  std::size_t size_ = 0;
+};
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_LAYOUT_H
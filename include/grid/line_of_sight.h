@@ -0,0 +1,133 @@
+#ifndef MMPL_GRID_LINE_OF_SIGHT_H
+#define MMPL_GRID_LINE_OF_SIGHT_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/occupancy.h>
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Checks if the straight segment between the centers of two cells crosses only free cells
+ *
+ *        Every cell whose interior the segment crosses must be free. Like diagonal moves on an 8-connected grid, the
+ *        segment may pass the corner of a single occupied cell, but never a corner shared by two diagonally adjacent
+ *        occupied cells. Cells are rows of contiguous bits in the occupancy bitmap, so the crossed span of each row is
+ *        checked with a single word-level range scan rather than with per-cell lookups.
+ *
+ * @param occupancy  grid occupancy
+ * @param from  segment start cell; must be in bounds
+ * @param to  segment end cell; must be in bounds
+ *
+ * @retval true  if no cell crossed by the segment is occupied, and no corner it passes is shared by two occupied cells
+ * @retval false  otherwise
+ */
+inline bool line_of_sight(const Occupancy<2>& occupancy, Cell<2> from, Cell<2> to)
+{
+  // Walk rows upwards
+  if (to[1] < from[1])
+  {
+    std::swap(from, to);
+  }
+
+  const Layout<2>& layout = occupancy.layout();
+  const Bitmap& bitmap = occupancy.bitmap();
+
+  const std::int32_t x_min = std::min(from[0], to[0]);
+  const std::int32_t x_max = std::max(from[0], to[0]);
+
+  // Segment within a single row
+  if (from[1] == to[1])
+  {
+    return !bitmap.any(layout.index(Coordinates<2>{x_min, from[1]}), layout.index(Coordinates<2>{x_max, from[1]}) + 1);
+  }
+
+  // Work in doubled coordinates, in which cell (i, j) covers [2i, 2i + 2) x [2j, 2j + 2) and cell centers are odd; the
+  // segment x-coordinate at doubled height y is then exactly (ax * dy + (y - ay) * dx) / dy
+  const std::int64_t ax = 2 * static_cast<std::int64_t>(from[0]) + 1;
+  const std::int64_t ay = 2 * static_cast<std::int64_t>(from[1]) + 1;
+  const std::int64_t by = 2 * static_cast<std::int64_t>(to[1]) + 1;
+  const std::int64_t dx = 2 * static_cast<std::int64_t>(to[0] - from[0]);
+  const std::int64_t dy = by - ay;
+
+  for (std::int32_t row = from[1]; row <= to[1]; ++row)
+  {
+    // Doubled x-coordinates (scaled by dy) where the segment enters and leaves this row
+    const std::int64_t y_enter = std::max<std::int64_t>(2 * row, ay);
+    const std::int64_t y_leave = std::min<std::int64_t>(2 * row + 2, by);
+    const std::int64_t x_enter = ax * dy + (y_enter - ay) * dx;
+    const std::int64_t x_leave = ax * dy + (y_leave - ay) * dx;
+
+    // Segment x-coordinates are strictly positive, so integer division floors; cells whose open interior overlaps
+    // the open span between the enter and leave points are crossed
+    const std::int64_t lo = std::min(x_enter, x_leave) / (2 * dy);
+    const std::int64_t hi = (std::max(x_enter, x_leave) + 2 * dy - 1) / (2 * dy) - 1;
+
+    const std::int32_t first = std::max(x_min, static_cast<std::int32_t>(lo));
+    const std::int32_t last = std::min(x_max, static_cast<std::int32_t>(hi));
+    if (bitmap.any(layout.index(Coordinates<2>{first, row}), layout.index(Coordinates<2>{last, row}) + 1))
+    {
+      return false;
+    }
+
+    // Segment entering this row through a corner passes between the two cells touched only at that corner
+    if (row != from[1] and x_enter % (2 * dy) == 0)
+    {
+      const auto corner = static_cast<std::int32_t>(x_enter / (2 * dy));
+      const std::int32_t below = (dx > 0) ? corner : corner - 1;
+      const std::int32_t above = (dx > 0) ? corner - 1 : corner;
+      if (bitmap.test(layout.index(Coordinates<2>{below, row - 1})) and
+          bitmap.test(layout.index(Coordinates<2>{above, row})))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+/**
+ * @brief Removes intermediate path cells which are not needed to keep line-of-sight between consecutive cells
+ *
+ *        Greedily keeps a path cell only when the next cell is not visible from the last kept cell, turning
+ *        staircase-shaped grid paths into any-angle paths through the same corridor. Operates in place, like
+ *        <code>std::unique</code>.
+ *
+ * @param occupancy  grid occupancy
+ * @param first  iterator to first path cell
+ * @param last  iterator one past last path cell
+ *
+ * @return iterator one past the last kept cell
+ */
+template <typename ForwardIteratorT>
+ForwardIteratorT string_pull(const Occupancy<2>& occupancy, ForwardIteratorT first, ForwardIteratorT last)
+{
+  if (first == last or std::next(first) == last)
+  {
+    return last;
+  }
+
+  ForwardIteratorT anchor = first;
+  ForwardIteratorT prev = std::next(first);
+  for (ForwardIteratorT curr = std::next(prev); curr != last; prev = curr++)
+  {
+    if (!line_of_sight(occupancy, *anchor, *curr))
+    {
+      *(++anchor) = *prev;
+    }
+  }
+  *(++anchor) = *prev;
+  return ++anchor;
+}
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_LINE_OF_SIGHT_H
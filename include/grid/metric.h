@@ -0,0 +1,157 @@
+#ifndef MMPL_GRID_METRIC_H
+#define MMPL_GRID_METRIC_H
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/metric.h>
+#include <mmpl/support.h>
+
+namespace mmpl::grid
+{
+
+template <std::size_t Dim, typename ValueT> class EuclideanMetric;
+
+template <std::size_t Dim, typename ValueT, typename StateT = Cell<Dim>> class StepMetric;
+
+}  // namespace mmpl::grid
+
+namespace mmpl
+{
+
+template <std::size_t Dim, typename ValueT> struct MetricTraits<grid::EuclideanMetric<Dim, ValueT>>
+{
+  using StateType = grid::Cell<Dim>;
+  using ValueType = ValueT;
+};
+
+
+
+template <std::size_t Dim, typename ValueT, typename StateT> struct MetricTraits<grid::StepMetric<Dim, ValueT, StateT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Straight-line distance between cell centers, in cell units
+ *
+ *        Valid between any pair of cells, not only neighbors, so it may be used to value any-angle edges
+ */
+template <std::size_t Dim, typename ValueT> class EuclideanMetric : public MetricBase<EuclideanMetric<Dim, ValueT>>
+{
+public:
+  static_assert(std::is_floating_point<ValueT>(), MMPL_STATIC_ASSERT_MSG("ValueT must be a floating point type"));
+
+private:
+  /**
+   * @copydoc MetricBase::get_value
+   */
+  inline ValueT get_value_impl(const Cell<Dim>& parent, const Cell<Dim>& child) const
+  {
+    ValueT squared_norm = 0;
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      const ValueT delta = static_cast<ValueT>(child[d] - parent[d]);
+      squared_norm += delta * delta;
+    }
+    return std::sqrt(squared_norm);
+  }
+
+  friend class MetricBase<EuclideanMetric<Dim, ValueT>>;
+};
+
+
+
+/**
+ * @brief Value of single steps between neighboring cells
+ *
+ *        Steps are valued by the number of coordinates they change (one for axis-aligned steps, two for 2D diagonal
+ *        steps, and so on) through a small lookup table, which keeps batched evaluation free of square roots and
+ *        branches.
+ *
+ *        <code>StateT</code> may be any cell-like state with integer coordinates accessed through
+ *        <code>operator[]</code> (e.g. grid::Voxel).
+ *
+ * @warn Only valid between cells whose coordinates differ by at most one along each dimension
+ */
+template <std::size_t Dim, typename ValueT, typename StateT>
+class StepMetric : public MetricBase<StepMetric<Dim, ValueT, StateT>>
+{
+public:
+  /**
+   * @brief Initializes step values to Euclidean step lengths, i.e. <code>sqrt(k)</code> for steps changing
+   *        <code>k</code> coordinates (truncated for integral value types)
+   */
+  StepMetric()
+  {
+    for (std::size_t k = 0; k <= Dim; ++k)
+    {
+      step_values_[k] = static_cast<ValueT>(std::sqrt(static_cast<double>(k)));
+    }
+  }
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param step_values  value of steps which change <code>k</code> coordinates, at index <code>k</code>
+   *                     (e.g. <code>{0, 10, 14}</code> for integral octile distances)
+   */
+  explicit StepMetric(const std::array<ValueT, Dim + 1>& step_values) : step_values_{step_values} {}
+
+private:
+  /**
+   * @brief Returns number of coordinates which differ between neighboring cells
+   */
+  static inline std::size_t changed_count(const StateT& parent, const StateT& child)
+  {
+    std::size_t count = 0;
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      count += static_cast<std::size_t>(parent[d] != child[d]);
+    }
+    return count;
+  }
+
+  /**
+   * @copydoc MetricBase::get_value
+   */
+  inline ValueT get_value_impl(const StateT& parent, const StateT& child) const
+  {
+    return step_values_[changed_count(parent, child)];
+  }
+
+  /**
+   * @copydoc MetricBase::get_values_impl
+   */
+  inline void get_values_impl(
+    const StateT& parent,
+    const StateT* const children,
+    ValueT* const values,
+    const std::size_t count) const
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      values[i] = step_values_[changed_count(parent, children[i])];
+    }
+  }
+
+  /// Step values, indexed by number of changed coordinates
+  std::array<ValueT, Dim + 1> step_values_;
+
+  friend class MetricBase<StepMetric<Dim, ValueT, StateT>>;
+};
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_METRIC_H
@@ -0,0 +1,282 @@
+#ifndef MMPL_GRID_MULTI_SOURCE_BFS_H
+#define MMPL_GRID_MULTI_SOURCE_BFS_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/layout.h>
+#include <mmpl/grid/neighborhood.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/support.h>
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Bit-parallel breadth-first search from many sources at once over a unit-cost grid
+ *
+ *        Each cell carries a lane of <code>LaneBits</code> bits, one per source. Frontiers of all sources are
+ *        propagated together with word-wide bitwise operations, so a single pass over the map replaces one search
+ *        per source. Lanes of 256 or 512 bits map onto SIMD registers when the compiler targets them.
+ *
+ * @tparam Dim  grid dimension
+ * @tparam Connectivity  neighborhood connectivity (see grid::Neighborhood)
+ * @tparam LaneBits  maximum number of sources per search; multiple of 64
+ */
+template <std::size_t Dim, std::size_t Connectivity, std::size_t LaneBits = 64> class MultiSourceBFS
+{
+public:
+  static_assert(LaneBits > 0 and LaneBits % 64 == 0, MMPL_STATIC_ASSERT_MSG("LaneBits must be a multiple of 64"));
+
+  /// Per-cell source bit lane
+  using LaneType = std::array<std::uint64_t, LaneBits / 64>;
+
+  /// Maximum number of sources per search
+  static constexpr std::size_t max_sources = LaneBits;
+
+  /// Distance associated with cells not reached from a source
+  static constexpr std::uint16_t UNREACHED = std::numeric_limits<std::uint16_t>::max();
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param occupancy  occupancy grid to search over
+   *
+   * @warn Referenced occupancy grid must outlive this object
+   */
+  explicit MultiSourceBFS(const Occupancy<Dim>& occupancy) :
+      occupancy_{std::addressof(occupancy)},
+      reached_(occupancy.layout().size()),
+      frontier_(occupancy.layout().size()),
+      next_(occupancy.layout().size())
+  {
+    for (std::size_t n = 0; n < Connectivity; ++n)
+    {
+      offsets_[n] = occupancy.layout().offset(Neighborhood<Dim, Connectivity>::offsets[n]);
+    }
+  }
+
+  /**
+   * @brief Runs search from a set of source cells
+   *
+   *        The i-th source cell is assigned source index <code>i</code>.
+   *
+   * @param first  iterator to first source cell
+   * @param last  iterator one past last source cell
+   * @param max_depth  maximum number of steps from any source
+   * @param record_distances  records per-source distance fields when true; otherwise only reachability is kept
+   *
+   * @return number of steps taken by the deepest frontier
+   */
+  template <typename CellIteratorT>
+  std::size_t run(
+    CellIteratorT first,
+    CellIteratorT last,
+    const std::size_t max_depth = UNREACHED - 1,
+    const bool record_distances = true)
+  {
+    const std::size_t cell_count = occupancy_->layout().size();
+
+    std::fill(reached_.begin(), reached_.end(), LaneType{});
+    active_.clear();
+
+    source_count_ = 0;
+    for (; first != last; ++first, ++source_count_)
+    {
+      MMPL_RUNTIME_ASSERT(source_count_ < max_sources);
+      MMPL_RUNTIME_ASSERT(!occupancy_->is_occupied(*first));
+      const std::uint32_t index = first->index();
+      if (is_empty(frontier_[index]))
+      {
+        active_.push_back(index);
+      }
+      set_bit(frontier_[index], source_count_);
+      set_bit(reached_[index], source_count_);
+    }
+
+    distances_.clear();
+    if (record_distances)
+    {
+      distances_.resize(source_count_ * cell_count, UNREACHED);
+      for (const std::uint32_t index : active_)
+      {
+        record(frontier_[index], index, 0);
+      }
+    }
+
+    std::size_t depth = 0;
+    while (!active_.empty() and depth < max_depth)
+    {
+      ++depth;
+
+      // Push frontier bits of all active cells to free, not-yet-reached neighbors
+      touched_.clear();
+      for (const std::uint32_t index : active_)
+      {
+        const LaneType& frontier = frontier_[index];
+        for (const std::int32_t offset : offsets_)
+        {
+          const std::uint32_t neighbor = index + offset;
+          if (occupancy_->bitmap().test(neighbor))
+          {
+            continue;
+          }
+
+          LaneType& next = next_[neighbor];
+          const bool was_empty = is_empty(next);
+          const LaneType& reached = reached_[neighbor];
+          for (std::size_t w = 0; w < next.size(); ++w)
+          {
+            next[w] |= frontier[w] & ~reached[w];
+          }
+
+          if (was_empty and !is_empty(next))
+          {
+            touched_.push_back(neighbor);
+          }
+        }
+      }
+
+      // Retire old frontier
+      for (const std::uint32_t index : active_)
+      {
+        frontier_[index] = LaneType{};
+      }
+
+      // Commit newly reached bits as next frontier
+      for (const std::uint32_t index : touched_)
+      {
+        LaneType& next = next_[index];
+        LaneType& reached = reached_[index];
+        for (std::size_t w = 0; w < next.size(); ++w)
+        {
+          reached[w] |= next[w];
+        }
+        if (record_distances)
+        {
+          record(next, index, depth);
+        }
+        frontier_[index] = next;
+        next = LaneType{};
+      }
+
+      active_.swap(touched_);
+    }
+
+    // Clear any unexpanded frontier left by depth limit
+    for (const std::uint32_t index : active_)
+    {
+      frontier_[index] = LaneType{};
+    }
+    return active_.empty() ? depth - (depth > 0) : depth;
+  }
+
+  /**
+   * @brief Returns number of sources used in the last search
+   */
+  inline std::size_t source_count() const { return source_count_; }
+
+  /**
+   * @brief Returns lane of sources from which <code>cell</code> was reached
+   */
+  inline const LaneType& reached(const Cell<Dim>& cell) const { return reached_[cell.index()]; }
+
+  /**
+   * @brief Checks if <code>cell</code> was reached from source <code>source</code>
+   */
+  inline bool is_reached(const std::size_t source, const Cell<Dim>& cell) const
+  {
+    return (reached_[cell.index()][source / 64] >> (source % 64)) & 1;
+  }
+
+  /**
+   * @brief Returns number of steps from source <code>source</code> to <code>cell</code>
+   *
+   * @note Requires last search to have recorded distances; returns UNREACHED if cell was not reached
+   */
+  inline std::uint16_t distance(const std::size_t source, const Cell<Dim>& cell) const
+  {
+    MMPL_RUNTIME_ASSERT(!distances_.empty());
+    return distances_[source * occupancy_->layout().size() + cell.index()];
+  }
+
+  /**
+   * @brief Returns distance field of source <code>source</code>, indexed by cell linear index
+   */
+  inline const std::uint16_t* distance_field(const std::size_t source) const
+  {
+    MMPL_RUNTIME_ASSERT(!distances_.empty());
+    return distances_.data() + source * occupancy_->layout().size();
+  }
+
+private:
+  static inline bool is_empty(const LaneType& lane)
+  {
+    std::uint64_t any = 0;
+    for (const std::uint64_t word : lane)
+    {
+      any |= word;
+    }
+    return any == 0;
+  }
+
+  static inline void set_bit(LaneType& lane, const std::size_t bit)
+  {
+    lane[bit / 64] |= std::uint64_t{1} << (bit % 64);
+  }
+
+  /**
+   * @brief Writes <code>depth</code> into distance fields of all sources set in <code>lane</code>
+   */
+  inline void record(const LaneType& lane, const std::uint32_t index, const std::size_t depth)
+  {
+    const std::size_t cell_count = occupancy_->layout().size();
+    for (std::size_t w = 0; w < lane.size(); ++w)
+    {
+      for (std::uint64_t bits = lane[w]; bits != 0; bits &= bits - 1)
+      {
+        const std::size_t source = w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits));
+        distances_[source * cell_count + index] = static_cast<std::uint16_t>(depth);
+      }
+    }
+  }
+
+  /// Occupancy grid being searched
+  const Occupancy<Dim>* occupancy_;
+
+  /// Linear index offsets to neighbors
+  std::array<std::int32_t, Connectivity> offsets_;
+
+  /// Per-cell lanes of sources by which cell was reached
+  std::vector<LaneType> reached_;
+
+  /// Per-cell lanes of sources for which cell is on the current frontier
+  std::vector<LaneType> frontier_;
+
+  /// Per-cell lanes of sources for which cell is on the next frontier
+  std::vector<LaneType> next_;
+
+  /// Linear indices of cells on the current frontier
+  std::vector<std::uint32_t> active_;
+
+  /// Linear indices of cells on the next frontier
+  std::vector<std::uint32_t> touched_;
+
+  /// Source-major distance fields
+  std::vector<std::uint16_t> distances_;
+
+  /// Number of sources used in last search
+  std::size_t source_count_ = 0;
+};
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_MULTI_SOURCE_BFS_H
@@ -0,0 +1,112 @@
+#ifndef MMPL_GRID_NEIGHBORHOOD_H
+#define MMPL_GRID_NEIGHBORHOOD_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Compile-time table of neighbor offsets for a grid of dimension <code>Dim</code>
+ *
+ *        Offsets are listed in direction-code order; the position of an offset in <code>offsets</code> is the
+ *        direction code used to refer to it elsewhere (e.g. in neighbor bit-masks)
+ */
+template <std::size_t Dim, std::size_t Connectivity> struct Neighborhood;
+
+
+/**
+ * @brief 4-connected 2D neighborhood
+ */
+template <> struct Neighborhood<2, 4>
+{
+  static constexpr std::array<Coordinates<2>, 4> offsets{{{0, -1}, {-1, 0}, {1, 0}, {0, 1}}};
+
+  /**
+   * @brief Returns direction code of the offset opposite to direction <code>code</code>
+   */
+  static constexpr std::uint8_t opposite(const std::uint8_t code) { return 3 - code; }
+};
+
+
+/**
+ * @brief 8-connected 2D neighborhood
+ *
+ *        Direction codes follow row-major order of the 3x3 block around a cell (center excluded), so that the
+ *        direction code of <code>-delta</code> is <code>7 - code(delta)</code>
+ */
+template <> struct Neighborhood<2, 8>
+{
+  static constexpr std::array<Coordinates<2>, 8> offsets{
+    {{-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1}}};
+
+  /**
+   * @brief Returns direction code of an offset with components in <code>[-1, 1]</code>
+   */
+  static constexpr std::uint8_t code(const Coordinates<2>& delta)
+  {
+    const std::int32_t block_index = (delta[0] + 1) + 3 * (delta[1] + 1);
+    return static_cast<std::uint8_t>(block_index < 4 ? block_index : block_index - 1);
+  }
+
+  /**
+   * @brief Returns direction code of the offset opposite to direction <code>code</code>
+   */
+  static constexpr std::uint8_t opposite(const std::uint8_t code) { return 7 - code; }
+};
+
+
+
+/**
+ * @brief 6-connected (face-adjacent) 3D neighborhood
+ */
+template <> struct Neighborhood<3, 6>
+{
+  static constexpr std::array<Coordinates<3>, 6> offsets{
+    {{0, 0, -1}, {0, -1, 0}, {-1, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
+
+  /**
+   * @brief Returns direction code of the offset opposite to direction <code>code</code>
+   */
+  static constexpr std::uint8_t opposite(const std::uint8_t code) { return 5 - code; }
+};
+
+
+/**
+ * @brief 26-connected 3D neighborhood
+ *
+ *        Direction codes follow the order of the 3x3x3 block around a cell (center excluded), first dimension varying
+ *        fastest, so that the direction code of <code>-delta</code> is <code>25 - code(delta)</code>
+ */
+template <> struct Neighborhood<3, 26>
+{
+  static constexpr std::array<Coordinates<3>, 26> offsets{{
+    {-1, -1, -1}, {0, -1, -1}, {1, -1, -1}, {-1, 0, -1}, {0, 0, -1}, {1, 0, -1}, {-1, 1, -1}, {0, 1, -1}, {1, 1, -1},
+    {-1, -1, 0},  {0, -1, 0},  {1, -1, 0},  {-1, 0, 0},  {1, 0, 0},  {-1, 1, 0}, {0, 1, 0},  {1, 1, 0},  {-1, -1, 1},
+    {0, -1, 1},   {1, -1, 1},  {-1, 0, 1},  {0, 0, 1},   {1, 0, 1},  {-1, 1, 1}, {0, 1, 1},  {1, 1, 1},
+  }};
+
+  /**
+   * @brief Returns direction code of an offset with components in <code>[-1, 1]</code>
+   */
+  static constexpr std::uint8_t code(const Coordinates<3>& delta)
+  {
+    const std::int32_t block_index = (delta[0] + 1) + 3 * (delta[1] + 1) + 9 * (delta[2] + 1);
+    return static_cast<std::uint8_t>(block_index < 13 ? block_index : block_index - 1);
+  }
+
+  /**
+   * @brief Returns direction code of the offset opposite to direction <code>code</code>
+   */
+  static constexpr std::uint8_t opposite(const std::uint8_t code) { return 25 - code; }
+};
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_NEIGHBORHOOD_H
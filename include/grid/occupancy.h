@@ -0,0 +1,103 @@
+#ifndef MMPL_GRID_OCCUPANCY_H
+#define MMPL_GRID_OCCUPANCY_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
+// MMPL
+#include <mmpl/grid/bitmap.h>
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/layout.h>
+#include <mmpl/support.h>
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Occupancy bitmap over a grid::Layout
+ *
+ *        Border cells reserved by the layout are always occupied, so neighbor validity checks against this bitmap
+ *        need no separate bounds check.
+ */
+template <std::size_t Dim> class Occupancy
+{
+public:
+  Occupancy() = default;
+
+  /**
+   * @brief Initialization constructor; all in-bounds cells are initially free
+   */
+  explicit Occupancy(const Layout<Dim>& layout) : layout_{layout}, occupied_{layout.size()}
+  {
+    for (std::uint32_t index = 0; index < layout_.size(); ++index)
+    {
+      if (!layout_.within(layout_.state(index).coordinates()))
+      {
+        occupied_.set(index);
+      }
+    }
+  }
+
+  /**
+   * @brief Returns grid layout
+   */
+  inline const Layout<Dim>& layout() const { return layout_; }
+
+  /**
+   * @brief Returns underlying occupancy bit plane
+   */
+  inline const Bitmap& bitmap() const { return occupied_; }
+
+  /**
+   * @brief Checks if cell is occupied
+   */
+  inline bool is_occupied(const Cell<Dim>& cell) const { return occupied_.test(cell.index()); }
+
+  /**
+   * @brief Checks if cell at <code>coordinates</code> is occupied; out-of-bounds coordinates are occupied
+   */
+  inline bool is_occupied(const Coordinates<Dim>& coordinates) const
+  {
+    return !layout_.within(coordinates) or occupied_.test(layout_.index(coordinates));
+  }
+
+  /**
+   * @brief Sets occupancy of an in-bounds cell
+   */
+  inline void set_occupied(const Coordinates<Dim>& coordinates, const bool occupied = true)
+  {
+    MMPL_RUNTIME_ASSERT(layout_.within(coordinates));
+    if (occupied)
+    {
+      occupied_.set(layout_.index(coordinates));
+    }
+    else
+    {
+      occupied_.reset(layout_.index(coordinates));
+    }
+  }
+
+  /**
+   * @brief Returns mask of free 8-connected neighbors of an in-bounds 2D cell
+   *
+   *        Bit <code>i</code> of the result corresponds to direction code <code>i</code> of
+   *        <code>Neighborhood<2, 8></code>
+   */
+  inline std::uint8_t free_neighbors(const Cell<Dim>& cell) const
+  {
+    static_assert(Dim == 2, "Neighbor masks are only available for 2D grids");
+    return static_cast<std::uint8_t>(~neighbor_mask(occupied_, cell.index(), layout_.stride(1)));
+  }
+
+private:
+  /// Grid layout
+  Layout<Dim> layout_;
+
+  /// Occupied cell bits
+  Bitmap occupied_;
+};
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_OCCUPANCY_H
@@ -0,0 +1,252 @@
+#ifndef MMPL_GRID_VOXEL_MAP_H
+#define MMPL_GRID_VOXEL_MAP_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/state.h>
+#include <mmpl/support.h>
+
+namespace mmpl::grid
+{
+
+class Voxel;
+
+}  // namespace mmpl::grid
+
+namespace mmpl
+{
+
+template <> struct StateTraits<grid::Voxel>
+{
+  using IDType = std::uint64_t;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::grid
+{
+
+/**
+ * @brief Packs 3D integer coordinates in <code>[-2^20, 2^20)</code> into a single 63-bit key
+ */
+constexpr std::uint64_t pack_coordinates(const Coordinates<3>& coordinates)
+{
+  constexpr std::int64_t bias = std::int64_t{1} << 20;
+  return static_cast<std::uint64_t>(coordinates[0] + bias) |
+    (static_cast<std::uint64_t>(coordinates[1] + bias) << 21) |
+    (static_cast<std::uint64_t>(coordinates[2] + bias) << 42);
+}
+
+
+/**
+ * @brief Voxel state on an unbounded sparse 3D grid
+ *
+ *        Unlike grid::Cell, voxels are not tied to a dense layout; their ID packs their coordinates, which may lie
+ *        anywhere in <code>[-2^20, 2^20)</code> along each axis
+ */
+class Voxel : public StateBase<Voxel>
+{
+public:
+  Voxel() = default;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param _coordinates  voxel coordinates
+   */
+  constexpr explicit Voxel(const Coordinates<3>& _coordinates) : coordinates_{_coordinates} {}
+
+  /**
+   * @brief Returns voxel coordinates
+   */
+  constexpr const Coordinates<3>& coordinates() const { return coordinates_; }
+
+  /**
+   * @brief Returns voxel coordinate along dimension <code>d</code>
+   */
+  constexpr std::int32_t operator[](const std::size_t d) const { return coordinates_[d]; }
+
+private:
+  /// Voxel coordinates
+  Coordinates<3> coordinates_;
+
+  /**
+   * @copydoc StateBase::id
+   */
+  inline std::uint64_t id_impl() const { return pack_coordinates(coordinates_); }
+
+  /**
+   * @copydoc StateBase::operator==
+   */
+  inline bool equals_impl(const Voxel& other) const { return this->coordinates_ == other.coordinates_; }
+
+  friend inline std::ostream& operator<<(std::ostream& os, const Voxel& voxel)
+  {
+    return os << '(' << voxel[0] << ", " << voxel[1] << ", " << voxel[2] << ')';
+  }
+
+  friend class StateBase<Voxel>;
+};
+
+
+/**
+ * @brief Sparse 3D occupancy map made of fixed-size 8x8x8 voxel blocks
+ *
+ *        Only blocks which contain at least one occupied voxel are stored, in a hash map keyed by block coordinates,
+ *        so memory use scales with the number of occupied blocks rather than with the mapped volume. Each block is a
+ *        512-bit occupancy mask (one 64-bit word per z-slice), and blocks are kept contiguous in a single array.
+ *
+ *        Voxels outside of the map bounds are reported as occupied, so neighbor enumeration needs no separate bounds
+ *        handling by callers.
+ */
+class VoxelBlockMap
+{
+public:
+  /// Number of voxels along each block edge, as a power of two
+  static constexpr std::int32_t BLOCK_SHIFT = 3;
+
+  /// Number of voxels along each block edge
+  static constexpr std::int32_t BLOCK_SIZE = 1 << BLOCK_SHIFT;
+
+  /// Number of voxels per block
+  static constexpr std::size_t BLOCK_VOLUME = BLOCK_SIZE * BLOCK_SIZE * BLOCK_SIZE;
+
+  /// Occupancy mask of a single block; bit <code>x + 8 * y</code> of word <code>z</code> is set if occupied
+  using Block = std::array<std::uint64_t, BLOCK_SIZE>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param min_coordinates  smallest in-bounds voxel coordinates
+   * @param max_coordinates  one past the largest in-bounds voxel coordinates
+   */
+  VoxelBlockMap(const Coordinates<3>& min_coordinates, const Coordinates<3>& max_coordinates) :
+      min_coordinates_{min_coordinates},
+      max_coordinates_{max_coordinates}
+  {}
+
+  /**
+   * @brief Returns coordinates of the block containing voxel <code>coordinates</code>
+   */
+  static constexpr Coordinates<3> block_coordinates(const Coordinates<3>& coordinates)
+  {
+    return {coordinates[0] >> BLOCK_SHIFT, coordinates[1] >> BLOCK_SHIFT, coordinates[2] >> BLOCK_SHIFT};
+  }
+
+  /**
+   * @brief Returns linear index of voxel <code>coordinates</code> within its block, in <code>[0, 512)</code>
+   */
+  static constexpr std::uint32_t local_index(const Coordinates<3>& coordinates)
+  {
+    constexpr std::int32_t mask = BLOCK_SIZE - 1;
+    return static_cast<std::uint32_t>(
+      (coordinates[0] & mask) | ((coordinates[1] & mask) << BLOCK_SHIFT) |
+      ((coordinates[2] & mask) << (2 * BLOCK_SHIFT)));
+  }
+
+  /**
+   * @brief Checks if voxel with linear block index <code>local</code> is occupied in <code>block</code>
+   */
+  static constexpr bool test(const Block& block, const std::uint32_t local)
+  {
+    return (block[local >> (2 * BLOCK_SHIFT)] >> (local & 63)) & 1;
+  }
+
+  /**
+   * @brief Checks if voxel <code>coordinates</code> lies within the map bounds
+   */
+  inline bool in_bounds(const Coordinates<3>& coordinates) const
+  {
+    return coordinates[0] >= min_coordinates_[0] and coordinates[0] < max_coordinates_[0] and
+      coordinates[1] >= min_coordinates_[1] and coordinates[1] < max_coordinates_[1] and
+      coordinates[2] >= min_coordinates_[2] and coordinates[2] < max_coordinates_[2];
+  }
+
+  /**
+   * @brief Returns block with coordinates <code>block_coordinates</code>; nullptr if it holds no occupied voxels
+   */
+  inline const Block* find_block(const Coordinates<3>& block_coordinates) const
+  {
+    const auto itr = block_index_.find(pack_coordinates(block_coordinates));
+    return (itr == block_index_.end()) ? nullptr : &blocks_[itr->second];
+  }
+
+  /**
+   * @brief Checks if voxel <code>coordinates</code> is occupied or out of bounds
+   */
+  inline bool is_occupied(const Coordinates<3>& coordinates) const
+  {
+    if (!in_bounds(coordinates))
+    {
+      return true;
+    }
+    const Block* const block = find_block(block_coordinates(coordinates));
+    return block != nullptr and test(*block, local_index(coordinates));
+  }
+
+  /**
+   * @brief Marks voxel <code>coordinates</code> as occupied or free
+   *
+   *        Blocks are allocated on first occupied voxel, and kept when their voxels are freed again
+   */
+  inline void set_occupied(const Coordinates<3>& coordinates, const bool occupied = true)
+  {
+    MMPL_RUNTIME_ASSERT(in_bounds(coordinates));
+    const std::uint32_t local = local_index(coordinates);
+    const std::uint64_t bit = std::uint64_t{1} << (local & 63);
+
+    const auto key = pack_coordinates(block_coordinates(coordinates));
+    if (const auto itr = block_index_.find(key); itr != block_index_.end())
+    {
+      std::uint64_t& word = blocks_[itr->second][local >> (2 * BLOCK_SHIFT)];
+      word = occupied ? (word | bit) : (word & ~bit);
+    }
+    else if (occupied)
+    {
+      block_index_.emplace(key, static_cast<std::uint32_t>(blocks_.size()));
+      blocks_.emplace_back();
+      blocks_.back().fill(0);
+      blocks_.back()[local >> (2 * BLOCK_SHIFT)] = bit;
+    }
+  }
+
+  /**
+   * @brief Returns number of stored blocks
+   */
+  inline std::size_t block_count() const { return blocks_.size(); }
+
+  /**
+   * @brief Returns smallest in-bounds voxel coordinates
+   */
+  inline const Coordinates<3>& min_coordinates() const { return min_coordinates_; }
+
+  /**
+   * @brief Returns one past the largest in-bounds voxel coordinates
+   */
+  inline const Coordinates<3>& max_coordinates() const { return max_coordinates_; }
+
+private:
+  /// Smallest in-bounds voxel coordinates
+  Coordinates<3> min_coordinates_;
+
+  /// One past the largest in-bounds voxel coordinates
+  Coordinates<3> max_coordinates_;
+
+  /// [packed block coordinates, block index] mapping
+  std::unordered_map<std::uint64_t, std::uint32_t> block_index_;
+
+  /// Stored block occupancy masks
+  std::vector<Block> blocks_;
+};
+
+}  // namespace mmpl::grid
+
+#endif  // MMPL_GRID_VOXEL_MAP_H
@@ -2,6 +2,7 @@
 #define MMPL_METRIC_H
 
 // C++ Standard Library
+#include <cstddef>
 
 // MMPL
 #include <mmpl/crtp.h>
@@ -32,6 +33,42 @@ public:
     return this->derived()->get_value_impl(parent, child);
   }
 
+  /**
+   * @brief Computes values of edges from a common parent to a batch of children
+   *
+   * @param parent  parent state
+   * @param children  pointer to first of <code>count</code> contiguous child states
+   * @param[out] values  pointer to first of <code>count</code> contiguous output values
+   * @param count  number of children
+   */
+  inline void operator()(
+    const StateType& parent,
+    const StateType* const children,
+    ValueType* const values,
+    const std::size_t count)
+  {
+    this->derived()->get_values_impl(parent, children, values, count);
+  }
+
+protected:
+  /**
+   * @brief Default batched value computation
+   *
+   *        Evaluates <code>get_value_impl</code> per child. Derived metrics may hide this with an implementation which
+   *        computes all values in a single vectorizable pass.
+   */
+  inline void get_values_impl(
+    const StateType& parent,
+    const StateType* const children,
+    ValueType* const values,
+    const std::size_t count)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      values[i] = this->derived()->get_value_impl(parent, children[i]);
+    }
+  }
+
 private:
   static_assert(is_value<ValueType>(), MMPL_STATIC_ASSERT_MSG("ValueType must be a valid metric value type"));
 
@@ -4,6 +4,8 @@
 #define MMPL_PLANNER_H
 
 // C++ Standard Library
+#include <array>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -15,6 +17,7 @@
 #include <mmpl/state_space.h>
 #include <mmpl/termination_criteria.h>
 #include <mmpl/planner_code.h>
+#include <mmpl/trace.h>
 
 namespace mmpl
 {
@@ -65,32 +68,29 @@ public:
     }
 
     // Get previous search predecessor
-    const auto pred = expansion_queue_.next();
+    const auto pred = MMPL_TRACE_EXPR("queue_pop", expansion_queue_.next());
 
-    // Enqueue next states from active parent
-    const auto enqueue_valid = [this, &metric, &pred](const StateType& child) {
-      // Dont enqueue if already expanded
-      if (expansion_table_.is_expanded(child))
-      {
-        return;
-      }
-
-      // Get cost from start to child
-      const ValueType next_total_value = pred.value + metric(pred.state, child);
+    // Let derived planners defer entries which are not ready for expansion
+    if (!this->derived()->resolve_impl(metric, pred))
+    {
+      return PlannerCode::SEARCHING;
+    }
 
-      // Update expansion information
-      if (expansion_table_.expand(pred.state, child, next_total_value))
+    // Skip stale entries which were superseded by a cheaper path to the same state
+    if constexpr (!expansion_table_is_write_once<ExpansionTableType>::value)
+    {
+      if (MMPL_TRACE_EXPR("table_lookup", expansion_table_.get_total_value(pred.state)) < pred.value)
       {
-        expansion_queue_.enqueue(child, next_total_value);
+        return PlannerCode::SEARCHING;
       }
-    };
+    }
 
     // Check if search is terminated
     if (is_terminal(termination_criteria, pred.state))
     {
       return PlannerCode::GOAL_FOUND;
     }
-    else if (state_space.for_each_child(pred.state, enqueue_valid))
+    else if (this->derived()->expand_children_impl(metric, state_space, pred))
     {
       return PlannerCode::SEARCHING;
     }
@@ -114,11 +114,7 @@ public:
     }
   }
 
-  inline void reset()
-  {
-    expansion_queue_.reset();
-    expansion_table_.reset();
-  }
+  inline void reset() { this->derived()->reset_impl(); }
 
   inline void enqueue(const StateType& state)
   {
@@ -126,11 +122,160 @@ public:
     expansion_table_.expand(state, state, Null<ValueType>::value);
   }
 
+  /**
+   * @brief Re-enqueues a previously expanded state at its recorded total value
+   *
+   *        Used to resume a search from states whose records remain valid after part of the expansion table was
+   *        invalidated
+   */
+  inline void requeue(const StateType& state)
+  {
+    expansion_queue_.enqueue(state, expansion_table_.get_total_value(state));
+  }
+
+  inline ExpansionTableType& expansion_table() { return expansion_table_; }
+
   inline const ExpansionTableType& expansion_table() const { return expansion_table_; }
 
+  inline ExpansionQueueType& expansion_queue() { return expansion_queue_; }
+
   inline const ExpansionQueueType& expansion_queue() const { return expansion_queue_; }
 
 protected:
+  /**
+   * @brief Default planner reset; clears expansion queue and expansion table
+   *
+   *        Derived planners which keep additional search state may hide this to clear it as well
+   */
+  inline void reset_impl()
+  {
+    expansion_queue_.reset();
+    expansion_table_.reset();
+  }
+
+  /**
+   * @brief Resolves an entry popped from the expansion queue before it is checked for expansion
+   *
+   *        Default resolution accepts every entry. Derived planners may hide this to finish deferred work on
+   *        <code>pred</code> (e.g. evaluating an edge value which was only estimated when <code>pred</code> was
+   *        enqueued), re-enqueueing it if needed.
+   *
+   * @retval true  if <code>pred</code> should be checked for termination and expanded now
+   * @retval false  otherwise
+   */
+  template <typename MetricT>
+  inline bool resolve_impl(
+    [[maybe_unused]] MetricBase<MetricT>& metric,
+    [[maybe_unused]] const StateValue<StateType, ValueType>& pred)
+  {
+    return true;
+  }
+
+  /**
+   * @brief Relaxes all children of <code>pred</code> and enqueues those reached more cheaply than before
+   *
+   *        Default child expansion; derived planners may hide this to change how children are reached.
+   *
+   *        Uses batched child expansion when <code>StateSpaceT</code> declares a child block size, in which case edge
+   *        values and previous total values of a whole block of children are computed before any are relaxed. When
+   *        the expansion table is write-once, children are only ever expanded on first discovery.
+   *
+   * @return result of child iteration on <code>state_space</code>
+   */
+  template <typename MetricT, typename StateSpaceT>
+  inline bool expand_children_impl(
+    MetricBase<MetricT>& metric,
+    StateSpaceBase<StateSpaceT>& state_space,
+    const StateValue<StateType, ValueType>& pred)
+  {
+    if constexpr (state_space_child_block_size<StateSpaceT>::value > 0)
+    {
+      using ChildBlockType = ChildBlock<StateType, state_space_child_block_size<StateSpaceT>::value>;
+
+      // Enqueue next states from active parent, one block at a time
+      const auto enqueue_valid = [this, &metric, &pred](const ChildBlockType& block) {
+        std::array<ValueType, ChildBlockType::capacity> edge_values;
+
+        // Get costs from parent to all children
+        MMPL_TRACE_EXPR("metric", metric(pred.state, block.states.data(), edge_values.data(), block.size));
+
+        if constexpr (expansion_table_is_write_once<ExpansionTableType>::value)
+        {
+          std::array<bool, ChildBlockType::capacity> expanded;
+          MMPL_TRACE_EXPR(
+            "table_lookup", expansion_table_.is_expanded(block.states.data(), expanded.data(), block.size));
+
+          for (std::size_t i = 0; i < block.size; ++i)
+          {
+            const ValueType next_total_value = pred.value + edge_values[i];
+
+            // Update expansion information; enqueue if child was not reached before
+            if (!expanded[i] and
+                MMPL_TRACE_EXPR("table_lookup", expansion_table_.expand(pred.state, block.states[i], next_total_value)))
+            {
+              MMPL_TRACE_EXPR("queue_push", expansion_queue_.enqueue(block.states[i], next_total_value));
+            }
+          }
+        }
+        else
+        {
+          std::array<ValueType, ChildBlockType::capacity> prev_total_values;
+          MMPL_TRACE_EXPR(
+            "table_lookup",
+            expansion_table_.try_get_total_value(block.states.data(), prev_total_values.data(), block.size));
+
+          for (std::size_t i = 0; i < block.size; ++i)
+          {
+            const ValueType next_total_value = pred.value + edge_values[i];
+
+            // Update expansion information; (re-)enqueue if child was not reached more cheaply before
+            if (next_total_value < prev_total_values[i] and
+                MMPL_TRACE_EXPR("table_lookup", expansion_table_.relax(pred.state, block.states[i], next_total_value)))
+            {
+              MMPL_TRACE_EXPR("queue_push", expansion_queue_.enqueue(block.states[i], next_total_value));
+            }
+          }
+        }
+      };
+      return MMPL_TRACE_EXPR("child_generation", state_space.for_each_child_block(pred.state, enqueue_valid));
+    }
+    else
+    {
+      // Enqueue next states from active parent
+      const auto enqueue_valid = [this, &metric, &pred](const StateType& child) {
+        if constexpr (expansion_table_is_write_once<ExpansionTableType>::value)
+        {
+          // Dont enqueue if already expanded
+          if (MMPL_TRACE_EXPR("table_lookup", expansion_table_.is_expanded(child)))
+          {
+            return;
+          }
+
+          // Get cost from start to child
+          const ValueType next_total_value = pred.value + MMPL_TRACE_EXPR("metric", metric(pred.state, child));
+
+          // Update expansion information
+          if (MMPL_TRACE_EXPR("table_lookup", expansion_table_.expand(pred.state, child, next_total_value)))
+          {
+            MMPL_TRACE_EXPR("queue_push", expansion_queue_.enqueue(child, next_total_value));
+          }
+        }
+        else
+        {
+          // Get cost from start to child
+          const ValueType next_total_value = pred.value + MMPL_TRACE_EXPR("metric", metric(pred.state, child));
+
+          // Update expansion information; (re-)enqueue if child was not reached more cheaply before
+          if (MMPL_TRACE_EXPR("table_lookup", expansion_table_.relax(pred.state, child, next_total_value)))
+          {
+            MMPL_TRACE_EXPR("queue_push", expansion_queue_.enqueue(child, next_total_value));
+          }
+        }
+      };
+      return MMPL_TRACE_EXPR("child_generation", state_space.for_each_child(pred.state, enqueue_valid));
+    }
+  }
+
   template <typename ExpansionQueueT = ExpansionQueueType, typename ExpansionTableT = ExpansionTableType>
   explicit PlannerBase(
     ExpansionQueueT&& queue = ExpansionQueueType{},
@@ -176,6 +321,8 @@ inline std::pair<PlannerCode, std::size_t> run_plan(
   const planner_state_t<PlannerT>& start,
   const planner_state_t<PlannerT>& goal)
 {
+  MMPL_TRACE_SCOPE("run_plan");
+
   planner.enqueue(start);
 
   PlannerCode code;
@@ -204,6 +351,54 @@ inline std::pair<PlannerCode, std::size_t> run_plan(
 }
 
 
+/**
+ * @brief Runs a single search from several sources at once
+ *
+ *        Every state within <code>radius</code> of a source is expanded with its value from the nearest source.
+ *        Sources are registered with the expansion table first, so expansion_table::SourceLabeled also recovers which
+ *        source that is, e.g. for nearest-facility assignment, instead of running one search per source.
+ *
+ * @param planner  planner to run; should be reset beforehand
+ * @param metric  edge value metric
+ * @param state_space  state space
+ * @param first  forward iterator to first source state
+ * @param last  forward iterator one past last source state
+ * @param radius  states with total value greater than this are left unexpanded
+ *
+ * @return pair of (planner code, iterations); code is INFEASIBLE once all reachable states were expanded
+ */
+template <typename PlannerT, typename MetricT, typename StateSpaceT, typename StateIteratorT>
+inline std::pair<PlannerCode, std::size_t> run_multi_source(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  StateSpaceBase<StateSpaceT>& state_space,
+  StateIteratorT first,
+  StateIteratorT last,
+  const planner_value_t<PlannerT>& radius = Invalid<planner_value_t<PlannerT>>::value)
+{
+  MMPL_TRACE_SCOPE("run_multi_source");
+
+  planner.expansion_table().set_sources(first, last);
+  for (; first != last; ++first)
+  {
+    planner.enqueue(*first);
+  }
+
+  CostRadiusTerminationCriteria<planner_state_t<PlannerT>, planner_value_t<PlannerT>> criteria{radius};
+
+  PlannerCode code;
+  std::size_t iterations{0};
+
+  while (code == PlannerCode::SEARCHING)
+  {
+    ++iterations;
+    code = planner.update(metric, state_space, criteria);
+  }
+
+  return std::make_pair(code, iterations);
+}
+
+
 template <typename StateT, typename ValueT, typename ExpansionQueueT, typename ExpansionTableT>
 struct PlannerTraits<ShortestPathPlanner<StateT, ValueT, ExpansionQueueT, ExpansionTableT>>
 {
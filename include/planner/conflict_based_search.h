@@ -0,0 +1,510 @@
+#ifndef MMPL_PLANNER_CONFLICT_BASED_SEARCH_H
+#define MMPL_PLANNER_CONFLICT_BASED_SEARCH_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/metric.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner_code.h>
+#include <mmpl/state_space.h>
+#include <mmpl/state_space/space_time.h>
+#include <mmpl/support.h>
+
+namespace mmpl::planner
+{
+
+/**
+ * @brief Conflict-Based Search (CBS) for optimal multi-agent paths
+ *
+ *        Searches a binary tree of constraint sets in order of sum of path values. Each tree node holds one path per
+ *        agent, each planned around that agent's constraints only. The first conflict between two agents (both at
+ *        the same state at the same time, or swapping states over the same time step) is resolved by branching on
+ *        which of the two agents is constrained to avoid it, and replanning that agent alone.
+ *
+ *        Low-level searches run over state_space::SpaceTime, with agent constraints held in a
+ *        state_space::ReservationTable, which the space-time state space and goal criteria already respect. Paths
+ *        are immutable and shared between tree nodes, so a child node only stores the path of the agent it replans.
+ *
+ *        Each agent keeps its own <code>LowLevelPlannerT</code>, holding its last search. Since every space-time move
+ *        advances time by one step, a constraint at time <code>t</code> only changes the search below
+ *        <code>t</code>: when an agent is replanned with a constraint set which differs from that of its last search,
+ *        records before the earliest changed time step are kept, and the search resumes from the states whose
+ *        children must be regenerated. Goal arrivals are the exception: whether one is accepted depends on
+ *        constraints on the goal at all later time steps, so kept goal arrivals are checked again whenever such a
+ *        constraint changed. Replanning with an unchanged constraint set reuses the last path outright.
+ *
+ * @note <code>LowLevelPlannerT</code> must be a planner over state_space::SpaceTimeState objects, searching in order
+ *       of total value (e.g. Dijkstra, or A* with a consistent heuristic), with an expansion table which supports
+ *       path extraction as well as <code>for_each</code> and <code>erase_if</code> (e.g. ShortestPathPlanner with
+ *       expansion_table::Unordered)
+ */
+template <typename LowLevelPlannerT> class ConflictBasedSearch
+{
+public:
+  using SpaceTimeStateType = planner_state_t<LowLevelPlannerT>;
+  using StateType = typename SpaceTimeStateType::UnderlyingStateType;
+  using ValueType = planner_value_t<LowLevelPlannerT>;
+  using PathType = std::vector<SpaceTimeStateType>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param max_time  last time step which any agent may reach
+   * @param max_nodes  maximum number of constraint tree nodes to generate before giving up
+   * @param args  low-level planner constructor arguments; the planner is copied once per agent
+   */
+  template <typename... ArgTs>
+  explicit ConflictBasedSearch(const std::uint32_t max_time, const std::size_t max_nodes, ArgTs&&... args) :
+      max_time_{max_time},
+      max_nodes_{max_nodes},
+      low_level_{std::forward<ArgTs>(args)...}
+  {}
+
+  /**
+   * @brief Searches for conflict-free paths with minimal sum of values for all agents
+   *
+   * @param metric  space-time metric (e.g. state_space::SpaceTimeMetric)
+   * @param state_space  state space shared by all agents
+   * @param starts_first  iterator to start state of first agent
+   * @param starts_last  iterator one past start state of last agent
+   * @param goals_first  iterator to goal state of first agent
+   *
+   * @return pair of (planner code, number of constraint tree nodes expanded); code is INFEASIBLE if some agent can
+   *         not reach its goal by <code>max_time</code>, or if <code>max_nodes</code> was exceeded
+   */
+  template <typename MetricT, typename StateSpaceT, typename StateIteratorT>
+  std::pair<PlannerCode, std::size_t> run(
+    MetricBase<MetricT>& metric,
+    StateSpaceBase<StateSpaceT>& state_space,
+    StateIteratorT starts_first,
+    StateIteratorT starts_last,
+    StateIteratorT goals_first)
+  {
+    nodes_.clear();
+    starts_.assign(starts_first, starts_last);
+    goals_.assign(goals_first, std::next(goals_first, starts_.size()));
+    searches_.assign(starts_.size(), AgentSearch{std::as_const(low_level_), {}, Solution{}, false});
+    solution_ = NO_NODE;
+    low_level_searches_ = 0;
+    low_level_iterations_ = 0;
+
+    state_space::SpaceTime<StateSpaceT> space_time{state_space, constraints_, max_time_};
+
+    // Root node; every agent is planned without constraints
+    nodes_.push_back(Node{NO_NODE, Constraint{}, {}, Null<ValueType>::value});
+    for (std::size_t agent = 0; agent < starts_.size(); ++agent)
+    {
+      const Solution solution = replan(metric, space_time, 0, agent);
+      if (!solution.path)
+      {
+        return std::make_pair(PlannerCode::INFEASIBLE, std::size_t{0});
+      }
+      nodes_.front().solutions.push_back(solution);
+      nodes_.front().value += solution.value;
+    }
+
+    using OpenEntry = std::pair<ValueType, std::size_t>;
+    std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry>> open;
+    open.emplace(nodes_.front().value, 0);
+
+    std::size_t iterations{0};
+    while (!open.empty())
+    {
+      const std::size_t index = open.top().second;
+      open.pop();
+      ++iterations;
+
+      Conflict conflict;
+      if (!find_conflict(nodes_[index], conflict))
+      {
+        solution_ = index;
+        return std::make_pair(PlannerCode::GOAL_FOUND, iterations);
+      }
+
+      // Branch on which of the two agents must avoid the conflict
+      for (const bool first_agent : {true, false})
+      {
+        if (nodes_.size() >= max_nodes_)
+        {
+          return std::make_pair(PlannerCode::INFEASIBLE, iterations);
+        }
+
+        const Constraint constraint = first_agent ?
+          Constraint{conflict.agents[0], conflict.edge, conflict.time, conflict.from, conflict.to} :
+          Constraint{conflict.agents[1], conflict.edge, conflict.time, conflict.to, conflict.from};
+
+        // Node must exist before replanning, which collects constraints by walking node ancestors
+        nodes_.push_back(Node{index, constraint, nodes_[index].solutions, nodes_[index].value});
+        const std::size_t child = nodes_.size() - 1;
+
+        const Solution solution = replan(metric, space_time, child, constraint.agent);
+        if (!solution.path)
+        {
+          nodes_.pop_back();
+          continue;
+        }
+
+        Node& node = nodes_[child];
+        node.value = node.value - node.solutions[constraint.agent].value + solution.value;
+        node.solutions[constraint.agent] = solution;
+        open.emplace(node.value, child);
+      }
+    }
+    return std::make_pair(PlannerCode::INFEASIBLE, iterations);
+  }
+
+  /**
+   * @brief Returns number of agents planned by the last call to <code>run</code>
+   */
+  inline std::size_t agent_count() const { return starts_.size(); }
+
+  /**
+   * @brief Returns conflict-free path of <code>agent</code>, from its start to its goal
+   *
+   * @warn Expects the following precondition to be satisfied: last call to <code>run</code> returned GOAL_FOUND
+   */
+  inline const PathType& path(const std::size_t agent) const
+  {
+    MMPL_RUNTIME_ASSERT(solution_ != NO_NODE);
+    return *nodes_[solution_].solutions[agent].path;
+  }
+
+  /**
+   * @brief Returns sum of path values of all agents
+   *
+   * @warn Expects the following precondition to be satisfied: last call to <code>run</code> returned GOAL_FOUND
+   */
+  inline ValueType value() const
+  {
+    MMPL_RUNTIME_ASSERT(solution_ != NO_NODE);
+    return nodes_[solution_].value;
+  }
+
+  /**
+   * @brief Enables resuming low-level searches from the last search of each agent; enabled by default
+   *
+   *        When disabled, every low-level search starts over, which is only useful as a baseline
+   */
+  inline void set_incremental(const bool incremental) { incremental_ = incremental; }
+
+  /**
+   * @brief Returns number of low-level searches run by the last call to <code>run</code>, excluding replans which
+   *        reused the last path of an agent outright
+   */
+  inline std::size_t low_level_searches() const { return low_level_searches_; }
+
+  /**
+   * @brief Returns total number of low-level planner iterations run by the last call to <code>run</code>
+   */
+  inline std::size_t low_level_iterations() const { return low_level_iterations_; }
+
+private:
+  /// Parent index of the root constraint tree node
+  static constexpr std::size_t NO_NODE = std::numeric_limits<std::size_t>::max();
+
+  /**
+   * @brief Constraint on a single agent
+   *
+   *        Vertex constraints forbid <code>agent</code> from occupying <code>from</code> at <code>time</code>; edge
+   *        constraints forbid it from moving from <code>from</code> to <code>to</code> over
+   *        <code>[time, time + 1]</code>
+   */
+  struct Constraint
+  {
+    std::size_t agent;
+    bool edge;
+    std::uint32_t time;
+    StateType from;
+    StateType to;
+
+    inline bool operator==(const Constraint& other) const
+    {
+      return agent == other.agent and edge == other.edge and time == other.time and from == other.from and
+        to == other.to;
+    }
+  };
+
+  /**
+   * @brief Conflict between two agents
+   *
+   *        Vertex conflicts have both agents at <code>from</code> (equal to <code>to</code>) at <code>time</code>; edge
+   *        conflicts have the first agent move from <code>from</code> to <code>to</code>, and the second agent move
+   *        back, over <code>[time, time + 1]</code>
+   */
+  struct Conflict
+  {
+    std::size_t agents[2];
+    bool edge;
+    std::uint32_t time;
+    StateType from;
+    StateType to;
+  };
+
+  /**
+   * @brief Path planned for one agent, shared between constraint tree nodes
+   */
+  struct Solution
+  {
+    std::shared_ptr<const PathType> path;
+    ValueType value;
+  };
+
+  /**
+   * @brief Constraint tree node
+   */
+  struct Node
+  {
+    /// Index of parent node
+    std::size_t parent;
+
+    /// Constraint added to those of the parent node
+    Constraint constraint;
+
+    /// Per-agent paths
+    std::vector<Solution> solutions;
+
+    /// Sum of path values
+    ValueType value;
+  };
+
+  /**
+   * @brief Low-level search state of one agent
+   */
+  struct AgentSearch
+  {
+    /// Planner holding the expansion table of the last search
+    LowLevelPlannerT planner;
+
+    /// Sorted constraints of the last search
+    std::vector<Constraint> constraints;
+
+    /// Result of the last search
+    Solution solution;
+
+    /// Whether any search was run
+    bool searched;
+  };
+
+  /**
+   * @brief Canonical constraint order, by time first
+   */
+  static inline bool precedes(const Constraint& lhs, const Constraint& rhs)
+  {
+    return std::make_tuple(lhs.time, lhs.edge, lhs.from.id(), lhs.to.id()) <
+      std::make_tuple(rhs.time, rhs.edge, rhs.from.id(), rhs.to.id());
+  }
+
+  /**
+   * @brief Returns state of <code>path</code> at <code>time</code>; agents stay at their goal after arriving
+   */
+  static inline const StateType& at(const PathType& path, const std::size_t time)
+  {
+    return path[std::min(time, path.size() - 1)].state();
+  }
+
+  /**
+   * @brief Finds the earliest conflict between any two agent paths of <code>node</code>
+   *
+   * @return true if a conflict was found
+   */
+  inline bool find_conflict(const Node& node, Conflict& conflict) const
+  {
+    std::size_t horizon = 0;
+    for (const Solution& solution : node.solutions)
+    {
+      horizon = std::max(horizon, solution.path->size());
+    }
+
+    for (std::size_t t = 0; t < horizon; ++t)
+    {
+      for (std::size_t i = 0; i < node.solutions.size(); ++i)
+      {
+        const PathType& path_i = *node.solutions[i].path;
+        for (std::size_t j = i + 1; j < node.solutions.size(); ++j)
+        {
+          const PathType& path_j = *node.solutions[j].path;
+          if (at(path_i, t) == at(path_j, t))
+          {
+            conflict = Conflict{{i, j}, false, static_cast<std::uint32_t>(t), at(path_i, t), at(path_i, t)};
+            return true;
+          }
+          else if (at(path_i, t) == at(path_j, t + 1) and at(path_i, t + 1) == at(path_j, t))
+          {
+            conflict = Conflict{{i, j}, true, static_cast<std::uint32_t>(t), at(path_i, t), at(path_i, t + 1)};
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Plans <code>agent</code> around all of its constraints held by <code>node</code> and its ancestors
+   *
+   * @return planned path and value; path is null if no path exists
+   */
+  template <typename MetricT, typename StateSpaceT>
+  Solution replan(
+    MetricBase<MetricT>& metric,
+    state_space::SpaceTime<StateSpaceT>& space_time,
+    std::size_t node,
+    const std::size_t agent)
+  {
+    // Collect constraints in canonical order, so that they may be compared with those of the last search
+    std::vector<Constraint> constraints;
+    for (; nodes_[node].parent != NO_NODE; node = nodes_[node].parent)
+    {
+      if (nodes_[node].constraint.agent == agent)
+      {
+        constraints.push_back(nodes_[node].constraint);
+      }
+    }
+    std::sort(constraints.begin(), constraints.end(), precedes);
+
+    // Agents always occupy their start state at time zero
+    if (!constraints.empty() and !constraints.front().edge and constraints.front().time == 0)
+    {
+      return Solution{nullptr, Null<ValueType>::value};
+    }
+
+    AgentSearch& search = searches_[agent];
+    if (search.searched and search.constraints == constraints)
+    {
+      return search.solution;
+    }
+
+    // Records of the last search before the earliest time step affected by a changed constraint remain valid
+    std::uint32_t resume_time = 0;
+    bool goal_changed = false;
+    if (incremental_ and search.searched)
+    {
+      changed_.clear();
+      std::set_symmetric_difference(
+        search.constraints.begin(),
+        search.constraints.end(),
+        constraints.begin(),
+        constraints.end(),
+        std::back_inserter(changed_),
+        precedes);
+
+      resume_time = std::numeric_limits<std::uint32_t>::max();
+      for (const Constraint& constraint : changed_)
+      {
+        resume_time = std::min(resume_time, constraint.edge ? constraint.time + 1 : constraint.time);
+        goal_changed |= (!constraint.edge and constraint.from == goals_[agent]);
+      }
+    }
+
+    constraints_.clear();
+    for (const Constraint& constraint : constraints)
+    {
+      if (constraint.edge)
+      {
+        // Reservations forbid moves which swap with a reserved move, so the reverse move is reserved
+        constraints_.reserve(0, constraint.to, constraint.from, constraint.time);
+      }
+      else
+      {
+        constraints_.reserve(0, constraint.from, constraint.time);
+      }
+    }
+
+    LowLevelPlannerT& planner = search.planner;
+    if (resume_time > 0)
+    {
+      // States not cheaper than the last goal may not have been expanded, and states right before the affected
+      // time steps lost their children; all other kept states were expanded with their children kept. Goal
+      // arrivals which were rejected may be accepted once a later constraint on the goal was dropped.
+      const ValueType bound = search.solution.path ? search.solution.value : Invalid<ValueType>::value;
+      const StateType& goal = goals_[agent];
+      planner.expansion_table().erase_if(
+        [resume_time](const SpaceTimeStateType& state) { return state.time() >= resume_time; });
+      planner.expansion_queue().reset();
+      planner.expansion_table().for_each(
+        [&planner, &goal, bound, resume_time, goal_changed](
+          const SpaceTimeStateType& state, const SpaceTimeStateType&, const ValueType& total_value) {
+          if (state.time() + 1 == resume_time or !(total_value < bound) or (goal_changed and state.state() == goal))
+          {
+            planner.requeue(state);
+          }
+        });
+    }
+    else
+    {
+      planner.reset();
+      planner.enqueue(SpaceTimeStateType{starts_[agent], 0});
+    }
+
+    ++low_level_searches_;
+    auto path = std::make_shared<PathType>();
+    const auto [code, iterations] =
+      state_space::resume_space_time(planner, metric, space_time, goals_[agent], *path);
+    low_level_iterations_ += iterations;
+    if (code != PlannerCode::GOAL_FOUND)
+    {
+      path.reset();
+    }
+
+    const ValueType value = path ? planner.expansion_table().get_total_value(path->back()) : Null<ValueType>::value;
+    search.constraints = std::move(constraints);
+    search.solution = Solution{std::move(path), value};
+    search.searched = true;
+    return search.solution;
+  }
+
+  /// Last time step which any agent may reach
+  std::uint32_t max_time_;
+
+  /// Maximum number of constraint tree nodes
+  std::size_t max_nodes_;
+
+  /// Low-level planner, copied for each agent
+  LowLevelPlannerT low_level_;
+
+  /// Whether low-level searches resume from the last search of each agent
+  bool incremental_ = true;
+
+  /// Constraints of the agent being replanned
+  state_space::ReservationTable constraints_;
+
+  /// Per-agent start states
+  std::vector<StateType> starts_;
+
+  /// Per-agent goal states
+  std::vector<StateType> goals_;
+
+  /// Constraint tree nodes
+  std::vector<Node> nodes_;
+
+  /// Per-agent low-level search state
+  std::vector<AgentSearch> searches_;
+
+  /// Constraints which differ between two constraint sets of an agent
+  std::vector<Constraint> changed_;
+
+  /// Index of conflict-free node found by last search
+  std::size_t solution_ = NO_NODE;
+
+  /// Number of low-level searches run by last search
+  std::size_t low_level_searches_ = 0;
+
+  /// Number of low-level planner iterations run by last search
+  std::size_t low_level_iterations_ = 0;
+};
+
+}  // namespace mmpl::planner
+
+#endif  // MMPL_PLANNER_CONFLICT_BASED_SEARCH_H
@@ -0,0 +1,252 @@
+#ifndef MMPL_PLANNER_DELTA_STEPPING_H
+#define MMPL_PLANNER_DELTA_STEPPING_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_queue.h>
+#include <mmpl/expansion_table.h>
+#include <mmpl/metric.h>
+#include <mmpl/state_space.h>
+#include <mmpl/support.h>
+#include <mmpl/value.h>
+#include <mmpl/worker_pool.h>
+
+namespace mmpl::planner
+{
+
+/**
+ * @brief Parallel delta-stepping single-source shortest paths
+ *
+ *        Computes exhaustive (or value-bounded) shortest path values from a single source. States are grouped into
+ *        buckets of width <code>delta</code> by total value; all states in the lowest non-empty bucket are expanded
+ *        in parallel. Edges no heavier than <code>delta</code> are relaxed repeatedly until the bucket settles, after
+ *        which heavier edges are relaxed once.
+ *
+ *        Buckets are kept in a cyclic array which only spans the buckets reachable by a single edge from the current
+ *        one, so memory use is bounded by the heaviest edge value over <code>delta</code>, not by path values. Each
+ *        bucket entry carries the total value it was filed with, and entries whose state has since improved are
+ *        skipped, so a state is expanded at most once per value, and its heavy edges once per bucket.
+ *
+ *        Results are written through <code>ExpansionTableBase::relax</code>, which must be safe to call concurrently
+ *        (e.g. expansion_table::DenseAtomic). <code>for_each_child</code> on the state space and evaluations of the
+ *        metric are also called concurrently from all workers.
+ */
+template <typename StateT, typename ValueT> class DeltaStepping
+{
+public:
+  static_assert(std::is_arithmetic<ValueT>(), MMPL_STATIC_ASSERT_MSG("ValueT must be an arithmetic type"));
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param delta  bucket width; edges with values no greater than this are "light"
+   * @param thread_count  number of threads used to expand buckets
+   */
+  explicit DeltaStepping(const ValueT delta, const std::size_t thread_count = std::thread::hardware_concurrency()) :
+      delta_{delta},
+      workers_{thread_count},
+      requests_(workers_.size())
+  {
+    MMPL_RUNTIME_ASSERT(delta_ > Null<ValueT>::value);
+  }
+
+  /**
+   * @brief Computes shortest path values from <code>source</code>
+   *
+   * @param expansion_table  concurrent expansion table receiving values and parents; reset before search
+   * @param metric  edge value metric
+   * @param state_space  state space to search
+   * @param source  search source state
+   * @param max_total_value  states with greater total values are not expanded
+   *
+   * @return number of parallel phases run
+   */
+  template <typename ExpansionTableT, typename MetricT, typename StateSpaceT>
+  std::size_t run(
+    ExpansionTableBase<ExpansionTableT>& expansion_table,
+    MetricBase<MetricT>& metric,
+    StateSpaceBase<StateSpaceT>& state_space,
+    const StateT& source,
+    const ValueT max_total_value = Invalid<ValueT>::value)
+  {
+    expansion_table.reset();
+    expansion_table.expand(source, source, Null<ValueT>::value);
+
+    for (auto& bucket : buckets_)
+    {
+      bucket.clear();
+    }
+    if (buckets_.empty())
+    {
+      buckets_.resize(1);
+    }
+    buckets_.front().emplace_back(source, Null<ValueT>::value);
+    last_bucket_ = 0;
+
+    std::size_t phases = 0;
+    for (std::size_t b = 0; b <= last_bucket_ and bucket_lower_bound(b) <= max_total_value; ++b)
+    {
+      settled_.clear();
+
+      // Relax light edges until no state re-enters the current bucket
+      while (!buckets_[b % buckets_.size()].empty())
+      {
+        frontier_.clear();
+        frontier_.swap(buckets_[b % buckets_.size()]);
+        expand(expansion_table, metric, state_space, frontier_, b, true, max_total_value);
+        settled_.insert(settled_.end(), frontier_.begin(), frontier_.end());
+        ++phases;
+      }
+
+      // Relax heavy edges of all settled states once
+      if (!settled_.empty())
+      {
+        expand(expansion_table, metric, state_space, settled_, b, false, max_total_value);
+        ++phases;
+      }
+    }
+    return phases;
+  }
+
+  /**
+   * @brief Returns number of buckets in the cyclic bucket array
+   */
+  inline std::size_t bucket_capacity() const { return buckets_.size(); }
+
+private:
+  using EntryType = StateValue<StateT, ValueT>;
+
+  /// Number of frontier states claimed by a worker at a time
+  static constexpr std::size_t CHUNK_SIZE = 64;
+
+  /**
+   * @brief Returns smallest total value held by bucket <code>b</code>
+   */
+  inline ValueT bucket_lower_bound(const std::size_t b) const { return static_cast<ValueT>(b) * delta_; }
+
+  /**
+   * @brief Returns index of bucket holding states with <code>total_value</code>
+   */
+  inline std::size_t bucket_index(const ValueT total_value) const
+  {
+    return static_cast<std::size_t>(total_value / delta_);
+  }
+
+  /**
+   * @brief Relaxes light or heavy edges of <code>states</code> in parallel, then files improved states into buckets
+   *
+   * @param states  states to expand
+   * @param bucket  index of bucket being settled
+   * @param light  relaxes edges no heavier than <code>delta</code> if true; all other edges otherwise
+   */
+  template <typename ExpansionTableT, typename MetricT, typename StateSpaceT>
+  void expand(
+    ExpansionTableBase<ExpansionTableT>& expansion_table,
+    MetricBase<MetricT>& metric,
+    StateSpaceBase<StateSpaceT>& state_space,
+    const std::vector<EntryType>& states,
+    const std::size_t bucket,
+    const bool light,
+    const ValueT max_total_value)
+  {
+    std::atomic<std::size_t> next_chunk{0};
+
+    workers_.run([&](const std::size_t worker_index) {
+      auto& requests = requests_[worker_index];
+      for (std::size_t first = next_chunk.fetch_add(CHUNK_SIZE); first < states.size();
+           first = next_chunk.fetch_add(CHUNK_SIZE))
+      {
+        const std::size_t last = std::min(first + CHUNK_SIZE, states.size());
+        for (std::size_t i = first; i < last; ++i)
+        {
+          const StateT& parent = states[i].state;
+          const ValueT total_value = states[i].value;
+
+          // Skip stale entries of states which were improved after being filed
+          if (expansion_table.get_total_value(parent) != total_value)
+          {
+            continue;
+          }
+
+          state_space.for_each_child(parent, [&](const StateT& child) {
+            const ValueT edge_value = metric(parent, child);
+            if ((edge_value <= delta_) != light)
+            {
+              return;
+            }
+
+            const ValueT next_total_value = total_value + edge_value;
+            if (next_total_value <= max_total_value and expansion_table.relax(parent, child, next_total_value))
+            {
+              requests.emplace_back(child, next_total_value);
+            }
+          });
+        }
+      }
+    });
+
+    // File improved states into buckets; none precede the current bucket, since edge values are not negative
+    for (auto& requests : requests_)
+    {
+      for (const EntryType& request : requests)
+      {
+        const std::size_t b = bucket_index(request.value);
+        if (b - bucket >= buckets_.size())
+        {
+          grow_buckets(bucket, b - bucket + 1);
+        }
+        buckets_[b % buckets_.size()].push_back(request);
+        last_bucket_ = std::max(last_bucket_, b);
+      }
+      requests.clear();
+    }
+  }
+
+  /**
+   * @brief Grows the cyclic bucket array to <code>span</code> buckets, keeping pending buckets in place
+   *
+   * @param bucket  index of bucket being settled; all pending buckets follow it within the current array
+   * @param span  new number of buckets
+   */
+  void grow_buckets(const std::size_t bucket, const std::size_t span)
+  {
+    std::vector<std::vector<EntryType>> grown(span);
+    for (std::size_t b = bucket; b < bucket + buckets_.size(); ++b)
+    {
+      grown[b % span].swap(buckets_[b % buckets_.size()]);
+    }
+    buckets_.swap(grown);
+  }
+
+  /// Bucket width
+  ValueT delta_;
+
+  /// Expansion workers
+  WorkerPool workers_;
+
+  /// Per-worker lists of improved states, with their new total values
+  std::vector<std::vector<EntryType>> requests_;
+
+  /// Cyclic array of states grouped by total value; bucket <code>b</code> is held at <code>b % buckets_.size()</code>
+  std::vector<std::vector<EntryType>> buckets_;
+
+  /// Index of last bucket which states were filed into
+  std::size_t last_bucket_ = 0;
+
+  /// States being expanded in the current phase
+  std::vector<EntryType> frontier_;
+
+  /// States expanded from the current bucket
+  std::vector<EntryType> settled_;
+};
+
+}  // namespace mmpl::planner
+
+#endif  // MMPL_PLANNER_DELTA_STEPPING_H
@@ -0,0 +1,95 @@
+#ifndef MMPL_PLANNER_FOCAL_SEARCH_H
+#define MMPL_PLANNER_FOCAL_SEARCH_H
+
+// C++ Standard Library
+#include <utility>
+
+// MMPL
+#include <mmpl/expansion_queue/focal.h>
+#include <mmpl/planner.h>
+
+namespace mmpl::planner
+{
+
+template <
+  typename StateT,
+  typename ValueT,
+  typename HeuristicFnT,
+  typename SecondaryFnT,
+  typename ExpansionTableT>
+class FocalSearch;
+
+}  // namespace mmpl::planner
+
+namespace mmpl
+{
+
+template <
+  typename StateT,
+  typename ValueT,
+  typename HeuristicFnT,
+  typename SecondaryFnT,
+  typename ExpansionTableT>
+struct PlannerTraits<planner::FocalSearch<StateT, ValueT, HeuristicFnT, SecondaryFnT, ExpansionTableT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+  using ExpansionQueueType = expansion_queue::Focal<StateT, ValueT, HeuristicFnT, SecondaryFnT>;
+  using ExpansionTableType = ExpansionTableT;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::planner
+{
+
+/**
+ * @brief Bounded-suboptimal focal search
+ *
+ *        Behaves like ShortestPathPlanner, but expands states from the FOCAL list of an expansion_queue::Focal: among
+ *        queued states whose <code>value + heuristic</code> lies within <code>weight</code> times the smallest such
+ *        estimate, the state with the lowest secondary key is expanded first. With an admissible heuristic, returned
+ *        paths are at most <code>weight</code> times as valuable as optimal paths, and a secondary key which measures
+ *        effort-to-go (e.g. steps to the goal) usually reaches the goal after far fewer expansions than A*.
+ *
+ *        States reached more cheaply after being expanded are re-opened, so the expansion table must support
+ *        relaxation.
+ */
+template <
+  typename StateT,
+  typename ValueT,
+  typename HeuristicFnT,
+  typename SecondaryFnT,
+  typename ExpansionTableT>
+class FocalSearch : public PlannerBase<FocalSearch<StateT, ValueT, HeuristicFnT, SecondaryFnT, ExpansionTableT>>
+{
+  using PlannerBaseType = PlannerBase<FocalSearch<StateT, ValueT, HeuristicFnT, SecondaryFnT, ExpansionTableT>>;
+
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param weight  suboptimality bound; at least 1
+   * @param heuristic  admissible estimate of the remaining value from a state to the goal
+   * @param secondary  FOCAL ordering key, invoked as <code>secondary(state, total_value)</code>
+   * @param args  expansion table initialization arguments
+   */
+  template <typename... ArgTs>
+  FocalSearch(const double weight, HeuristicFnT heuristic, SecondaryFnT secondary, ArgTs&&... args) :
+      PlannerBaseType{
+        expansion_queue::Focal<StateT, ValueT, HeuristicFnT, SecondaryFnT>{
+          weight, std::move(heuristic), std::move(secondary)},
+        ExpansionTableT{std::forward<ArgTs>(args)...}}
+  {}
+
+private:
+  static_assert(
+    !expansion_table_is_write_once<ExpansionTableT>::value,
+    MMPL_STATIC_ASSERT_MSG("Focal search requires an expansion table which supports relaxation"));
+
+  friend PlannerBaseType;
+};
+
+}  // namespace mmpl::planner
+
+#endif  // MMPL_PLANNER_FOCAL_SEARCH_H
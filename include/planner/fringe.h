@@ -0,0 +1,225 @@
+#ifndef MMPL_PLANNER_FRINGE_H
+#define MMPL_PLANNER_FRINGE_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/metric.h>
+#include <mmpl/planner_code.h>
+#include <mmpl/state_space.h>
+#include <mmpl/support.h>
+#include <mmpl/termination_criteria.h>
+#include <mmpl/value.h>
+
+namespace mmpl::planner
+{
+
+/**
+ * @brief Fringe search
+ *
+ *        Like IDA*, expands states in iterations with a rising bound on value plus heuristic estimate, but keeps the
+ *        search fringe between iterations instead of restarting from the start state. The fringe is an intrusive
+ *        doubly-linked list over dense state IDs (two 32-bit links per state), and best known values and parents are
+ *        cached in <code>ExpansionTableT</code>; both are allocated once, up front, so no memory is allocated while
+ *        searching. States deferred to the next iteration stay in place in the list, children are inserted right after
+ *        the state being expanded, so no priority queue is needed.
+ *
+ *        The heuristic is a metric evaluated as <code>heuristic(state, goal)</code>, and must not overestimate the
+ *        remaining value for returned paths to be optimal. Found paths may be extracted from the expansion table
+ *        (e.g. with <code>generate_path</code>).
+ *
+ *        <code>IndexerT</code> maps dense IDs back to states and must provide:
+ *        - <code>std::size_t size() const</code>, one past the largest state ID
+ *        - <code>StateT state(std::uint32_t id) const</code>
+ *
+ *        (e.g. grid::Layout, state_space::CsrGraph)
+ *
+ * @warn Referenced indexer must outlive this object
+ */
+template <typename StateT, typename ValueT, typename ExpansionTableT, typename IndexerT> class Fringe
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param indexer  maps dense state IDs to states
+   * @param expansion_table  value and parent cache; should be dense (e.g. expansion_table::DenseAtomic)
+   */
+  explicit Fringe(const IndexerT& indexer, ExpansionTableT&& expansion_table) :
+      indexer_{std::addressof(indexer)},
+      head_{END},
+      terminal_{END},
+      next_(indexer.size(), END),
+      prev_(indexer.size(), UNLISTED),
+      expansion_table_{std::move(expansion_table)}
+  {}
+
+  /**
+   * @brief Searches for a path from <code>start</code> to a state satisfying <code>termination_criteria</code>
+   *
+   * @param metric  edge value metric
+   * @param heuristic  metric estimating remaining value from a state to <code>goal</code>
+   * @param state_space  state space to search
+   * @param termination_criteria  search termination criteria
+   * @param start  start state
+   * @param goal  goal state passed to <code>heuristic</code>
+   *
+   * @return pair of (planner code, number of fringe iterations)
+   */
+  template <typename MetricT, typename HeuristicT, typename StateSpaceT, typename TerminationCriteriaT>
+  std::pair<PlannerCode, std::size_t> run(
+    MetricBase<MetricT>& metric,
+    MetricBase<HeuristicT>& heuristic,
+    StateSpaceBase<StateSpaceT>& state_space,
+    TerminationCriteriaBase<TerminationCriteriaT>& termination_criteria,
+    const StateT& start,
+    const StateT& goal)
+  {
+    clear();
+    terminal_ = END;
+    expansion_table_.reset();
+    expansion_table_.expand(start, start, Null<ValueT>::value);
+    insert_after(END, start.id());
+
+    ValueT bound = heuristic(start, goal);
+    std::size_t iterations = 0;
+    while (head_ != END)
+    {
+      ++iterations;
+
+      ValueT next_bound = Invalid<ValueT>::value;
+      for (std::uint32_t id = head_; id != END;)
+      {
+        const StateT state = indexer_->state(id);
+        const ValueT value = expansion_table_.get_total_value(state);
+
+        // Defer states estimated to exceed the bound to a later iteration
+        const ValueT estimate = value + heuristic(state, goal);
+        if (bound < estimate)
+        {
+          next_bound = std::min(next_bound, estimate);
+          id = next_[id];
+          continue;
+        }
+        else if (termination_criteria.is_terminal(state))
+        {
+          terminal_ = id;
+          clear();
+          return std::make_pair(PlannerCode{PlannerCode::GOAL_FOUND}, iterations);
+        }
+
+        // Insert children reached more cheaply than before right after this state, in enumeration order
+        std::uint32_t last = id;
+        state_space.for_each_child(state, [&](const StateT& child) {
+          if (expansion_table_.relax(state, child, value + metric(state, child)))
+          {
+            if (prev_[child.id()] != UNLISTED)
+            {
+              remove(child.id());
+            }
+            insert_after(last, child.id());
+            last = child.id();
+          }
+        });
+
+        const std::uint32_t next = next_[id];
+        remove(id);
+        id = next;
+      }
+      bound = next_bound;
+    }
+    return std::make_pair(PlannerCode{PlannerCode::INFEASIBLE}, iterations);
+  }
+
+  /**
+   * @brief Returns state at which the last successful search terminated
+   */
+  inline StateT terminal() const
+  {
+    MMPL_RUNTIME_ASSERT(terminal_ != END);
+    return indexer_->state(terminal_);
+  }
+
+  /**
+   * @brief Returns value and parent cache
+   */
+  inline const ExpansionTableT& expansion_table() const { return expansion_table_; }
+
+private:
+  /// Link value marking the end of the list (next) or its head (previous)
+  static constexpr std::uint32_t END = std::numeric_limits<std::uint32_t>::max() - 1;
+
+  /// Previous link value marking states which are not in the list
+  static constexpr std::uint32_t UNLISTED = std::numeric_limits<std::uint32_t>::max();
+
+  /**
+   * @brief Inserts state with <code>id</code> after state <code>pos</code>; at list head if <code>pos == END</code>
+   */
+  inline void insert_after(const std::uint32_t pos, const std::uint32_t id)
+  {
+    const std::uint32_t next = (pos == END) ? head_ : next_[pos];
+    prev_[id] = pos;
+    next_[id] = next;
+    if (next != END)
+    {
+      prev_[next] = id;
+    }
+    (pos == END ? head_ : next_[pos]) = id;
+  }
+
+  /**
+   * @brief Removes state with <code>id</code> from the list
+   */
+  inline void remove(const std::uint32_t id)
+  {
+    const std::uint32_t prev = prev_[id];
+    const std::uint32_t next = next_[id];
+    (prev == END ? head_ : next_[prev]) = next;
+    if (next != END)
+    {
+      prev_[next] = prev;
+    }
+    prev_[id] = UNLISTED;
+  }
+
+  /**
+   * @brief Removes all states from the list, in time linear in list length
+   */
+  inline void clear()
+  {
+    while (head_ != END)
+    {
+      remove(head_);
+    }
+  }
+
+  /// Maps dense IDs to states
+  const IndexerT* indexer_;
+
+  /// ID of first state in list
+  std::uint32_t head_;
+
+  /// ID of state at which the last search terminated
+  std::uint32_t terminal_;
+
+  /// Per-state ID of next state in list
+  std::vector<std::uint32_t> next_;
+
+  /// Per-state ID of previous state in list
+  std::vector<std::uint32_t> prev_;
+
+  /// Value and parent cache
+  ExpansionTableT expansion_table_;
+};
+
+}  // namespace mmpl::planner
+
+#endif  // MMPL_PLANNER_FRINGE_H
@@ -0,0 +1,172 @@
+#ifndef MMPL_PLANNER_IDA_STAR_H
+#define MMPL_PLANNER_IDA_STAR_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/metric.h>
+#include <mmpl/planner_code.h>
+#include <mmpl/state_space.h>
+#include <mmpl/support.h>
+#include <mmpl/termination_criteria.h>
+#include <mmpl/value.h>
+
+namespace mmpl::planner
+{
+
+/**
+ * @brief Iterative-deepening A* (IDA*)
+ *
+ *        Repeats depth-first searches from the start state, each pruning states whose value plus heuristic estimate
+ *        exceeds a bound; the bound is raised to the smallest pruned estimate between iterations. Only the current
+ *        path is held in memory, in a buffer allocated once for <code>max_depth</code> edges, so memory use does not
+ *        depend on the size of the state space. Revisits of states already on the current path are skipped; other
+ *        transpositions are searched again.
+ *
+ *        The heuristic is a metric evaluated as <code>heuristic(state, goal)</code>, and must not overestimate the
+ *        remaining value for returned paths to be optimal.
+ *
+ * @note Depth-first recursion goes as deep as <code>max_depth</code>
+ */
+template <typename StateT, typename ValueT> class IDAStar
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param max_depth  maximum number of edges in a path; deeper states are not searched
+   */
+  explicit IDAStar(const std::size_t max_depth) : max_depth_{max_depth}, path_value_{Invalid<ValueT>::value}
+  {
+    path_.reserve(max_depth_ + 1);
+  }
+
+  /**
+   * @brief Searches for a path from <code>start</code> to a state satisfying <code>termination_criteria</code>
+   *
+   * @param metric  edge value metric
+   * @param heuristic  metric estimating remaining value from a state to <code>goal</code>
+   * @param state_space  state space to search
+   * @param termination_criteria  search termination criteria
+   * @param start  start state
+   * @param goal  goal state passed to <code>heuristic</code>
+   *
+   * @return pair of (planner code, number of depth-first iterations)
+   */
+  template <typename MetricT, typename HeuristicT, typename StateSpaceT, typename TerminationCriteriaT>
+  std::pair<PlannerCode, std::size_t> run(
+    MetricBase<MetricT>& metric,
+    MetricBase<HeuristicT>& heuristic,
+    StateSpaceBase<StateSpaceT>& state_space,
+    TerminationCriteriaBase<TerminationCriteriaT>& termination_criteria,
+    const StateT& start,
+    const StateT& goal)
+  {
+    static_assert(
+      !TerminationCriteriaTraits<TerminationCriteriaT>::is_expansion_aware,
+      MMPL_STATIC_ASSERT_MSG("IDA* keeps no expansion table; termination criteria must not require one"));
+
+    path_.clear();
+    path_.push_back(start);
+    path_value_ = Invalid<ValueT>::value;
+
+    ValueT bound = heuristic(start, goal);
+    for (std::size_t iterations = 1;; ++iterations)
+    {
+      next_bound_ = Invalid<ValueT>::value;
+      if (search(metric, heuristic, state_space, termination_criteria, goal, Null<ValueT>::value, bound))
+      {
+        return std::make_pair(PlannerCode{PlannerCode::GOAL_FOUND}, iterations);
+      }
+      else if (next_bound_ == Invalid<ValueT>::value)
+      {
+        path_.clear();
+        return std::make_pair(PlannerCode{PlannerCode::INFEASIBLE}, iterations);
+      }
+      bound = next_bound_;
+    }
+  }
+
+  /**
+   * @brief Returns path found by last search, from start to terminal state; empty if none was found
+   */
+  inline const std::vector<StateT>& path() const { return path_; }
+
+  /**
+   * @brief Returns total value of path found by last search
+   */
+  inline ValueT path_value() const { return path_value_; }
+
+private:
+  /**
+   * @brief Depth-first search below the last state of the current path
+   *
+   * @retval true  if a terminal state was found; current path then ends at that state
+   * @retval false  otherwise
+   */
+  template <typename MetricT, typename HeuristicT, typename StateSpaceT, typename TerminationCriteriaT>
+  bool search(
+    MetricBase<MetricT>& metric,
+    MetricBase<HeuristicT>& heuristic,
+    StateSpaceBase<StateSpaceT>& state_space,
+    TerminationCriteriaBase<TerminationCriteriaT>& termination_criteria,
+    const StateT& goal,
+    const ValueT& value,
+    const ValueT& bound)
+  {
+    const StateT state = path_.back();
+
+    // Prune states estimated to exceed the bound, and remember the cheapest pruned estimate
+    const ValueT estimate = value + heuristic(state, goal);
+    if (bound < estimate)
+    {
+      next_bound_ = std::min(next_bound_, estimate);
+      return false;
+    }
+    else if (termination_criteria.is_terminal(state))
+    {
+      path_value_ = value;
+      return true;
+    }
+    else if (path_.size() > max_depth_)
+    {
+      return false;
+    }
+
+    bool found = false;
+    state_space.for_each_child(state, [&](const StateT& child) {
+      if (found or std::find(path_.begin(), path_.end(), child) != path_.end())
+      {
+        return;
+      }
+
+      path_.push_back(child);
+      found = search(metric, heuristic, state_space, termination_criteria, goal, value + metric(state, child), bound);
+      if (!found)
+      {
+        path_.pop_back();
+      }
+    });
+    return found;
+  }
+
+  /// Maximum number of edges in a path
+  std::size_t max_depth_;
+
+  /// Current path; holds found path after a successful search
+  std::vector<StateT> path_;
+
+  /// Total value of found path
+  ValueT path_value_;
+
+  /// Smallest estimate pruned during the current iteration
+  ValueT next_bound_;
+};
+
+}  // namespace mmpl::planner
+
+#endif  // MMPL_PLANNER_IDA_STAR_H
@@ -0,0 +1,207 @@
+#ifndef MMPL_PLANNER_LAZY_SHORTEST_PATH_H
+#define MMPL_PLANNER_LAZY_SHORTEST_PATH_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/metric.h>
+#include <mmpl/planner.h>
+#include <mmpl/state.h>
+#include <mmpl/support.h>
+
+namespace mmpl::planner
+{
+
+template <
+  typename StateT,
+  typename ValueT,
+  typename EstimateMetricT,
+  typename ExpansionQueueT,
+  typename ExpansionTableT>
+class LazyShortestPath;
+
+}  // namespace mmpl::planner
+
+namespace mmpl
+{
+
+template <
+  typename StateT,
+  typename ValueT,
+  typename EstimateMetricT,
+  typename ExpansionQueueT,
+  typename ExpansionTableT>
+struct PlannerTraits<planner::LazyShortestPath<StateT, ValueT, EstimateMetricT, ExpansionQueueT, ExpansionTableT>>
+{
+  using StateType = StateT;
+  using ValueType = ValueT;
+  using ExpansionQueueType = ExpansionQueueT;
+  using ExpansionTableType = ExpansionTableT;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::planner
+{
+
+/**
+ * @brief Shortest-path search which defers evaluation of expensive edge values (Lazy Weighted A*)
+ *
+ *        Behaves like ShortestPathPlanner, except that children are enqueued with a cheap, optimistic estimate of
+ *        their edge value instead of the true value. The true value is only computed by the (expensive) planning
+ *        metric once an estimated entry reaches the front of the queue: the child is then relaxed with its true value,
+ *        and re-enqueued unless the estimate was exact. Edges to children which are never popped are never evaluated.
+ *
+ *        Each estimated entry is held as a pending edge from its parent, so several pending edges to one child may be
+ *        queued at once; only evaluated values are recorded in the expansion table.
+ *
+ *        The estimate must never exceed the true edge value for returned paths to be optimal.
+ *
+ * @warn Referenced estimate metric must outlive this object
+ */
+template <
+  typename StateT,
+  typename ValueT,
+  typename EstimateMetricT,
+  typename ExpansionQueueT,
+  typename ExpansionTableT>
+class LazyShortestPath
+    : public PlannerBase<LazyShortestPath<StateT, ValueT, EstimateMetricT, ExpansionQueueT, ExpansionTableT>>
+{
+  using PlannerBaseType =
+    PlannerBase<LazyShortestPath<StateT, ValueT, EstimateMetricT, ExpansionQueueT, ExpansionTableT>>;
+
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param estimate  cheap metric which never overestimates the planning metric
+   * @param args  expansion queue and expansion table initialization arguments
+   */
+  template <typename... ArgTs>
+  explicit LazyShortestPath(MetricBase<EstimateMetricT>& estimate, ArgTs&&... args) :
+      PlannerBaseType{std::forward<ArgTs>(args)...},
+      estimate_{std::addressof(estimate)}
+  {}
+
+  /**
+   * @brief Returns number of edges evaluated with the planning metric since the last reset
+   */
+  inline std::size_t evaluations() const { return evaluations_; }
+
+  /**
+   * @brief Returns number of queued edges which have not been evaluated yet
+   */
+  inline std::size_t pending() const { return pending_.size(); }
+
+private:
+  static_assert(
+    !expansion_table_is_write_once<ExpansionTableT>::value,
+    MMPL_STATIC_ASSERT_MSG("Lazy edge evaluation requires an expansion table which supports relaxation"));
+
+  using PlannerBaseType::expansion_queue_;
+  using PlannerBaseType::expansion_table_;
+
+  /**
+   * @brief Queued edge whose value was only estimated
+   */
+  struct PendingEdge
+  {
+    /// Parent state
+    StateT parent;
+
+    /// Total value of parent when the edge was queued
+    ValueT parent_value;
+
+    /// Total value of child through this edge, as estimated
+    ValueT estimated_value;
+  };
+
+  /**
+   * @copydoc PlannerBase::reset_impl
+   */
+  inline void reset_impl()
+  {
+    PlannerBaseType::reset_impl();
+    pending_.clear();
+    evaluations_ = 0;
+  }
+
+  /**
+   * @copydoc PlannerBase::resolve_impl
+   */
+  template <typename MetricT>
+  inline bool resolve_impl(MetricBase<MetricT>& metric, const StateValue<StateT, ValueT>& pred)
+  {
+    // Entries without a matching pending edge hold evaluated values
+    auto [itr, last] = pending_.equal_range(pred.state);
+    while (itr != last and itr->second.estimated_value != pred.value)
+    {
+      ++itr;
+    }
+    if (itr == last)
+    {
+      return true;
+    }
+
+    const PendingEdge edge = std::move(itr->second);
+    pending_.erase(itr);
+
+    ++evaluations_;
+    const ValueT total_value = edge.parent_value + metric(edge.parent, pred.state);
+    if (!expansion_table_.relax(edge.parent, pred.state, total_value))
+    {
+      return false;
+    }
+    else if (total_value == pred.value)
+    {
+      // Estimate was exact, so pred is still at the front of the queue
+      return true;
+    }
+
+    expansion_queue_.enqueue(pred.state, total_value);
+    return false;
+  }
+
+  /**
+   * @copydoc PlannerBase::expand_children_impl
+   */
+  template <typename MetricT, typename StateSpaceT>
+  inline bool expand_children_impl(
+    [[maybe_unused]] MetricBase<MetricT>& metric,
+    StateSpaceBase<StateSpaceT>& state_space,
+    const StateValue<StateT, ValueT>& pred)
+  {
+    const auto enqueue_estimated = [this, &pred](const StateT& child) {
+      const ValueT estimated_value = pred.value + (*estimate_)(pred.state, child);
+
+      // True value is never lower than estimated, so skip children which were already reached as cheaply
+      if (estimated_value < expansion_table_.try_get_total_value(child))
+      {
+        pending_.emplace(child, PendingEdge{pred.state, pred.value, estimated_value});
+        expansion_queue_.enqueue(child, estimated_value);
+      }
+    };
+    return state_space.for_each_child(pred.state, enqueue_estimated);
+  }
+
+  /// Cheap metric which never overestimates the planning metric
+  MetricBase<EstimateMetricT>* estimate_;
+
+  /// Queued edges which have not been evaluated yet, by child state
+  std::unordered_multimap<StateT, PendingEdge, state_default_hash_t<StateT>> pending_;
+
+  /// Number of evaluated edges
+  std::size_t evaluations_ = 0;
+
+  friend PlannerBaseType;
+};
+
+}  // namespace mmpl::planner
+
+#endif  // MMPL_PLANNER_LAZY_SHORTEST_PATH_H
@@ -0,0 +1,112 @@
+#ifndef MMPL_PLANNER_THETA_STAR_H
+#define MMPL_PLANNER_THETA_STAR_H
+
+// C++ Standard Library
+#include <memory>
+#include <utility>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/line_of_sight.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/planner.h>
+
+namespace mmpl::planner
+{
+
+template <typename ValueT, typename ExpansionQueueT, typename ExpansionTableT> class ThetaStar;
+
+}  // namespace mmpl::planner
+
+namespace mmpl
+{
+
+template <typename ValueT, typename ExpansionQueueT, typename ExpansionTableT>
+struct PlannerTraits<planner::ThetaStar<ValueT, ExpansionQueueT, ExpansionTableT>>
+{
+  using StateType = grid::Cell<2>;
+  using ValueType = ValueT;
+  using ExpansionQueueType = ExpansionQueueT;
+  using ExpansionTableType = ExpansionTableT;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::planner
+{
+
+/**
+ * @brief Any-angle (Theta*) search over 2D grid cells
+ *
+ *        Behaves like ShortestPathPlanner, except that each child is first offered to the parent of the state being
+ *        expanded: when that parent has line-of-sight to the child, the child is relaxed directly from it. Recorded
+ *        parents therefore form any-angle paths, whose consecutive states need not be grid neighbors.
+ *
+ *        The metric must value straight segments between arbitrary cells (e.g. grid::EuclideanMetric). The state
+ *        space still enumerates grid neighbors, and should agree with <code>occupancy</code> on which cells are free.
+ *        The expansion table must accept parents which are not grid neighbors (e.g. expansion_table::Unordered).
+ *
+ * @warn Referenced occupancy grid must outlive this object
+ */
+template <typename ValueT, typename ExpansionQueueT, typename ExpansionTableT>
+class ThetaStar : public PlannerBase<ThetaStar<ValueT, ExpansionQueueT, ExpansionTableT>>
+{
+  using PlannerBaseType = PlannerBase<ThetaStar<ValueT, ExpansionQueueT, ExpansionTableT>>;
+
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param occupancy  grid occupancy used for line-of-sight checks
+   * @param args  expansion queue and expansion table initialization arguments
+   */
+  template <typename... ArgTs>
+  explicit ThetaStar(const grid::Occupancy<2>& occupancy, ArgTs&&... args) :
+      PlannerBaseType{std::forward<ArgTs>(args)...},
+      occupancy_{std::addressof(occupancy)}
+  {}
+
+private:
+  using PlannerBaseType::expansion_queue_;
+  using PlannerBaseType::expansion_table_;
+
+  /**
+   * @copydoc PlannerBase::expand_children_impl
+   */
+  template <typename MetricT, typename StateSpaceT>
+  inline bool expand_children_impl(
+    MetricBase<MetricT>& metric,
+    StateSpaceBase<StateSpaceT>& state_space,
+    const StateValue<grid::Cell<2>, ValueT>& pred)
+  {
+    const grid::Cell<2> grandparent = expansion_table_.get_parent(pred.state);
+    const bool has_grandparent = !(grandparent == pred.state);
+    const ValueT grandparent_value = has_grandparent ? expansion_table_.get_total_value(grandparent) : pred.value;
+
+    const auto enqueue_valid = [this, &metric, &pred, &grandparent, grandparent_value, has_grandparent](
+                                 const grid::Cell<2>& child) {
+      // Path through the grandparent is never longer than through pred, by the triangle inequality
+      const bool through_grandparent = has_grandparent and grid::line_of_sight(*occupancy_, grandparent, child);
+
+      const grid::Cell<2>& parent = through_grandparent ? grandparent : pred.state;
+      const ValueT parent_value = through_grandparent ? grandparent_value : pred.value;
+      const ValueT next_total_value = parent_value + metric(parent, child);
+
+      // Update expansion information; (re-)enqueue if child was not reached more cheaply before
+      if (expansion_table_.relax(parent, child, next_total_value))
+      {
+        expansion_queue_.enqueue(child, next_total_value);
+      }
+    };
+    return state_space.for_each_child(pred.state, enqueue_valid);
+  }
+
+  /// Grid occupancy used for line-of-sight checks
+  const grid::Occupancy<2>* occupancy_;
+
+  friend PlannerBaseType;
+};
+
+}  // namespace mmpl::planner
+
+#endif  // MMPL_PLANNER_THETA_STAR_H
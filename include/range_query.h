@@ -0,0 +1,66 @@
+#ifndef MMPL_RANGE_QUERY_H
+#define MMPL_RANGE_QUERY_H
+
+// MMPL
+#include <mmpl/expansion_table/range_mask.h>
+#include <mmpl/expansion_table/range_set.h>
+#include <mmpl/metric.h>
+#include <mmpl/planner.h>
+#include <mmpl/state_space.h>
+
+namespace mmpl
+{
+
+/**
+ * @brief Finds all states reachable from a set of sources within total value <code>radius</code>
+ *
+ *        Resets <code>planner</code> and runs it until every state within <code>radius</code> of a source has been
+ *        expanded, with its value from the nearest source. The expansion table of <code>planner</code> must be an
+ *        expansion_table::RangeSet or expansion_table::RangeMask; it receives <code>radius</code>, so states beyond it
+ *        are neither recorded nor enqueued, and the search ends as soon as the queue minimum would exceed
+ *        <code>radius</code>.
+ *
+ * @param planner  planner whose expansion table is an expansion_table::RangeSet or expansion_table::RangeMask
+ * @param metric  edge value metric
+ * @param state_space  state space
+ * @param first  iterator to first source state
+ * @param last  iterator one past last source state
+ * @param radius  largest total value of reached states
+ *
+ * @return expansion table of <code>planner</code>, holding the reached states and their total values
+ */
+template <typename PlannerT, typename MetricT, typename StateSpaceT, typename StateIteratorT>
+inline const planner_expansion_table_t<PlannerT>& run_range_query(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  StateSpaceBase<StateSpaceT>& state_space,
+  StateIteratorT first,
+  StateIteratorT last,
+  const planner_value_t<PlannerT>& radius)
+{
+  planner.reset();
+  planner.expansion_table().set_radius(radius);
+  run_multi_source(planner, metric, state_space, first, last, radius);
+  return planner.expansion_table();
+}
+
+
+/**
+ * @brief Finds all states reachable from <code>source</code> within total value <code>radius</code>
+ *
+ * @see run_range_query
+ */
+template <typename PlannerT, typename MetricT, typename StateSpaceT>
+inline const planner_expansion_table_t<PlannerT>& run_range_query(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  StateSpaceBase<StateSpaceT>& state_space,
+  const planner_state_t<PlannerT>& source,
+  const planner_value_t<PlannerT>& radius)
+{
+  return run_range_query(planner, metric, state_space, &source, &source + 1, radius);
+}
+
+}  // namespace mmpl
+
+#endif  // MMPL_RANGE_QUERY_H
@@ -0,0 +1,135 @@
+#ifndef MMPL_SAMPLING_CONFIGURATION_H
+#define MMPL_SAMPLING_CONFIGURATION_H
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// MMPL
+#include <mmpl/metric.h>
+#include <mmpl/state.h>
+
+namespace mmpl::sampling
+{
+
+/// Point in a <code>Dim</code>-dimensional continuous configuration space
+template <std::size_t Dim> using Point = std::array<double, Dim>;
+
+
+template <std::size_t Dim> class Configuration;
+
+template <std::size_t Dim> class EuclideanMetric;
+
+}  // namespace mmpl::sampling
+
+namespace mmpl
+{
+
+template <std::size_t Dim> struct StateTraits<sampling::Configuration<Dim>>
+{
+  using IDType = std::uint32_t;
+};
+
+
+template <std::size_t Dim> struct MetricTraits<sampling::EuclideanMetric<Dim>>
+{
+  using StateType = sampling::Configuration<Dim>;
+  using ValueType = double;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::sampling
+{
+
+/**
+ * @brief Sampled configuration, identified by its dense index in a roadmap or tree
+ *
+ *        Carries its point, so that metrics over configurations need no lookup. Only the index participates in state
+ *        identity.
+ */
+template <std::size_t Dim> class Configuration : public StateBase<Configuration<Dim>>
+{
+public:
+  /// Index associated with configurations which were not added to a roadmap or tree
+  static constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+  Configuration() = default;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param _point  configuration point
+   * @param _index  dense index of configuration
+   */
+  Configuration(const Point<Dim>& _point, const std::uint32_t _index) : point_{_point}, index_{_index} {}
+
+  /**
+   * @brief Returns configuration point
+   */
+  constexpr const Point<Dim>& point() const { return point_; }
+
+  /**
+   * @brief Returns dense index of configuration
+   */
+  constexpr std::uint32_t index() const { return index_; }
+
+private:
+  /// Configuration point
+  Point<Dim> point_ = {};
+
+  /// Dense index of configuration
+  std::uint32_t index_ = NO_INDEX;
+
+  /**
+   * @copydoc StateBase::id
+   */
+  inline std::uint32_t id_impl() const { return index_; }
+
+  /**
+   * @copydoc StateBase::operator==
+   */
+  inline bool equals_impl(const Configuration& other) const { return this->index_ == other.index_; }
+
+  friend class StateBase<Configuration<Dim>>;
+};
+
+
+/**
+ * @brief Returns squared Euclidean distance between two points
+ */
+template <std::size_t Dim> inline double squared_distance(const Point<Dim>& lhs, const Point<Dim>& rhs)
+{
+  double sum = 0.0;
+  for (std::size_t d = 0; d < Dim; ++d)
+  {
+    const double delta = lhs[d] - rhs[d];
+    sum += delta * delta;
+  }
+  return sum;
+}
+
+
+/**
+ * @brief Euclidean distance between configuration points
+ */
+template <std::size_t Dim> class EuclideanMetric : public MetricBase<EuclideanMetric<Dim>>
+{
+private:
+  /**
+   * @copydoc MetricBase::get_value
+   */
+  inline double get_value_impl(const Configuration<Dim>& parent, const Configuration<Dim>& child) const
+  {
+    return std::sqrt(squared_distance(parent.point(), child.point()));
+  }
+
+  friend class MetricBase<EuclideanMetric<Dim>>;
+};
+
+}  // namespace mmpl::sampling
+
+#endif  // MMPL_SAMPLING_CONFIGURATION_H
@@ -0,0 +1,509 @@
+#ifndef MMPL_SAMPLING_KD_TREE_H
+#define MMPL_SAMPLING_KD_TREE_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/sampling/configuration.h>
+#include <mmpl/support.h>
+
+namespace mmpl::sampling
+{
+
+/**
+ * @brief Bucketed KD-tree nearest-neighbor index over <code>Dim</code>-dimensional points
+ *
+ *        Points are stored once, contiguously, and identified by their dense insertion index. Tree nodes are held in
+ *        a flat array; leaves hold up to <code>BUCKET_SIZE</code> point indices, which are scanned linearly, so the
+ *        tree stays shallow and most distance computations run over short contiguous index runs.
+ *
+ *        The tree may be bulk-built from a batch of points, which splits on exact medians for a balanced tree (e.g.
+ *        for PRM roadmaps), and points may be inserted one at a time afterwards, which splits full leaves on the
+ *        median of their widest dimension (e.g. for RRT trees).
+ *
+ *        Batched k-nearest queries answer many queries with a single scratch heap. Queries do not modify the tree, so
+ *        batches may also be split across threads, as long as no point is inserted concurrently.
+ */
+template <std::size_t Dim> class KdTree
+{
+public:
+  /// Index returned when there is no matching point
+  static constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+  /// Maximum number of point indices held by a leaf
+  static constexpr std::uint32_t BUCKET_SIZE = 16;
+
+  KdTree() { clear(); }
+
+  /**
+   * @brief Removes all points
+   */
+  inline void clear()
+  {
+    points_.clear();
+    nodes_.assign(1, Node::leaf(0));
+    leaves_.assign(1, Leaf{});
+  }
+
+  /**
+   * @brief Replaces all points with a batch of points, building a balanced tree over them
+   *
+   * @param first  iterator to first point
+   * @param last  iterator one past last point
+   */
+  template <typename PointIteratorT> void build(PointIteratorT first, PointIteratorT last)
+  {
+    points_.assign(first, last);
+    MMPL_RUNTIME_ASSERT(points_.size() < NO_INDEX);
+
+    std::vector<std::uint32_t> indices(points_.size());
+    for (std::uint32_t i = 0; i < indices.size(); ++i)
+    {
+      indices[i] = i;
+    }
+
+    nodes_.clear();
+    leaves_.clear();
+    build_node(indices.data(), indices.data() + indices.size());
+  }
+
+  /**
+   * @brief Inserts a single point
+   *
+   * @return index of inserted point
+   */
+  inline std::uint32_t insert(const Point<Dim>& point)
+  {
+    MMPL_RUNTIME_ASSERT(points_.size() < NO_INDEX);
+    const std::uint32_t index = static_cast<std::uint32_t>(points_.size());
+    points_.push_back(point);
+
+    std::uint32_t node = 0;
+    while (!nodes_[node].is_leaf())
+    {
+      node = nodes_[node].child(point);
+    }
+
+    Leaf& leaf = leaves_[nodes_[node].leaf_index()];
+    if (leaf.count < BUCKET_SIZE)
+    {
+      leaf.items[leaf.count++] = index;
+    }
+    else
+    {
+      split_leaf(node, index);
+    }
+    return index;
+  }
+
+  /**
+   * @brief Returns number of points
+   */
+  inline std::size_t size() const { return points_.size(); }
+
+  /**
+   * @brief Checks if there are no points
+   */
+  inline bool empty() const { return points_.empty(); }
+
+  /**
+   * @brief Returns point with insertion <code>index</code>
+   */
+  inline const Point<Dim>& point(const std::uint32_t index) const { return points_[index]; }
+
+  /**
+   * @brief Returns index of point nearest to <code>query</code>; NO_INDEX if there are no points
+   */
+  inline std::uint32_t nearest(const Point<Dim>& query) const
+  {
+    Neighbor best{std::numeric_limits<double>::infinity(), NO_INDEX};
+    search_nearest(0, query, best);
+    return best.index;
+  }
+
+  /**
+   * @brief Batched counterpart of <code>nearest</code>
+   *
+   * @param queries  pointer to first of <code>count</code> contiguous query points
+   * @param[out] indices  pointer to first of <code>count</code> outputs
+   * @param count  number of queries
+   *
+   * @note Convenience wrapper which runs one independent <code>nearest</code> query per point; single nearest
+   *       queries need no scratch buffer, so there is nothing to share between them
+   */
+  inline void nearest(const Point<Dim>* const queries, std::uint32_t* const indices, const std::size_t count) const
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      indices[i] = nearest(queries[i]);
+    }
+  }
+
+  /**
+   * @brief Finds up to <code>k</code> points nearest to <code>query</code>
+   *
+   * @param query  query point
+   * @param k  maximum number of neighbors
+   * @param[out] indices  receives neighbor indices, nearest first; cleared beforehand
+   */
+  inline void nearest_k(const Point<Dim>& query, const std::size_t k, std::vector<std::uint32_t>& indices) const
+  {
+    std::vector<Neighbor> heap;
+    heap.reserve(k);
+    search_nearest_k(query, k, heap);
+
+    indices.clear();
+    for (const auto& neighbor : heap)
+    {
+      indices.push_back(neighbor.index);
+    }
+  }
+
+  /**
+   * @brief Batched counterpart of <code>nearest_k</code>
+   *
+   *        Neighbors of all queries are written to a single flat array, <code>k</code> per query and nearest first;
+   *        queries with fewer than <code>k</code> neighbors are padded with NO_INDEX
+   *
+   * @param queries  pointer to first of <code>count</code> contiguous query points
+   * @param count  number of queries
+   * @param k  number of neighbors per query
+   * @param[out] indices  pointer to first of <code>count * k</code> outputs
+   */
+  inline void nearest_k(
+    const Point<Dim>* const queries,
+    const std::size_t count,
+    const std::size_t k,
+    std::uint32_t* const indices) const
+  {
+    std::vector<Neighbor> heap;
+    heap.reserve(k);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      search_nearest_k(queries[i], k, heap);
+
+      std::uint32_t* const output = indices + i * k;
+      std::fill(output, output + k, NO_INDEX);
+      for (std::size_t j = 0; j < heap.size(); ++j)
+      {
+        output[j] = heap[j].index;
+      }
+    }
+  }
+
+  /**
+   * @brief Finds all points within <code>radius</code> of <code>query</code>, inclusive
+   *
+   * @param query  query point
+   * @param radius  search radius
+   * @param[out] indices  receives neighbor indices, in no particular order; cleared beforehand
+   */
+  inline void within_radius(const Point<Dim>& query, const double radius, std::vector<std::uint32_t>& indices) const
+  {
+    indices.clear();
+    search_radius(0, query, radius * radius, indices);
+  }
+
+private:
+  /**
+   * @brief Candidate neighbor, ordered by squared distance
+   */
+  struct Neighbor
+  {
+    /// Squared distance to query
+    double squared_distance;
+
+    /// Point index
+    std::uint32_t index;
+
+    inline bool operator<(const Neighbor& other) const { return squared_distance < other.squared_distance; }
+  };
+
+  /**
+   * @brief Tree node; either an internal split node or a leaf
+   *
+   *        Points held under the lower child have coordinates no greater than the split value, and points held under
+   *        the upper child no less
+   */
+  struct Node
+  {
+    /// Split dimension of leaf nodes
+    static constexpr std::uint32_t LEAF = std::numeric_limits<std::uint32_t>::max();
+
+    /// Split value
+    double split;
+
+    /// Split dimension; LEAF for leaf nodes
+    std::uint32_t dim;
+
+    /// Lower child node index; leaf index of leaf nodes
+    std::uint32_t lower;
+
+    /// Upper child node index
+    std::uint32_t upper;
+
+    static inline Node leaf(const std::uint32_t leaf_index) { return Node{0.0, LEAF, leaf_index, 0}; }
+
+    inline bool is_leaf() const { return dim == LEAF; }
+
+    inline std::uint32_t leaf_index() const { return lower; }
+
+    inline std::uint32_t child(const Point<Dim>& point) const { return (point[dim] < split) ? lower : upper; }
+  };
+
+  /**
+   * @brief Point indices held by a leaf
+   */
+  struct Leaf
+  {
+    /// Number of valid items
+    std::uint32_t count = 0;
+
+    /// Point indices
+    std::array<std::uint32_t, BUCKET_SIZE> items;
+  };
+
+  /**
+   * @brief Returns dimension along which <code>[first, last)</code> points have the widest spread
+   */
+  inline std::uint32_t widest_dim(const std::uint32_t* const first, const std::uint32_t* const last) const
+  {
+    std::uint32_t widest = 0;
+    double widest_spread = -1.0;
+    for (std::uint32_t d = 0; d < Dim; ++d)
+    {
+      double lo = std::numeric_limits<double>::infinity();
+      double hi = -std::numeric_limits<double>::infinity();
+      for (const std::uint32_t* itr = first; itr != last; ++itr)
+      {
+        lo = std::min(lo, points_[*itr][d]);
+        hi = std::max(hi, points_[*itr][d]);
+      }
+      if (hi - lo > widest_spread)
+      {
+        widest = d;
+        widest_spread = hi - lo;
+      }
+    }
+    return widest;
+  }
+
+  /**
+   * @brief Partitions <code>[first, last)</code> point indices at their median along <code>dim</code>
+   *
+   *        Points in the lower partition have coordinates no greater than the split value, and points in the upper
+   *        partition no less; both partitions are non-empty, even if points coincide
+   *
+   * @return split value, and pointer to first index of upper partition
+   */
+  inline std::pair<double, std::uint32_t*>
+  partition(std::uint32_t* const first, std::uint32_t* const last, const std::uint32_t dim) const
+  {
+    std::uint32_t* const middle = first + (last - first) / 2;
+    std::nth_element(first, middle, last, [this, dim](const std::uint32_t lhs, const std::uint32_t rhs) {
+      return points_[lhs][dim] < points_[rhs][dim];
+    });
+    return std::make_pair(points_[*middle][dim], middle);
+  }
+
+  /**
+   * @brief Appends a leaf node holding <code>[first, last)</code>
+   */
+  inline std::uint32_t add_leaf(const std::uint32_t* const first, const std::uint32_t* const last)
+  {
+    MMPL_RUNTIME_ASSERT(last - first <= BUCKET_SIZE);
+    Leaf leaf;
+    leaf.count = static_cast<std::uint32_t>(std::copy(first, last, leaf.items.begin()) - leaf.items.begin());
+    leaves_.push_back(leaf);
+    nodes_.push_back(Node::leaf(static_cast<std::uint32_t>(leaves_.size() - 1)));
+    return static_cast<std::uint32_t>(nodes_.size() - 1);
+  }
+
+  /**
+   * @brief Recursively builds a balanced subtree over <code>[first, last)</code> point indices
+   *
+   * @return index of subtree root node
+   */
+  std::uint32_t build_node(std::uint32_t* const first, std::uint32_t* const last)
+  {
+    if (last - first <= BUCKET_SIZE)
+    {
+      return add_leaf(first, last);
+    }
+
+    const std::uint32_t dim = widest_dim(first, last);
+    const auto [split, upper] = partition(first, last, dim);
+
+    const std::uint32_t node = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.push_back(Node{split, dim, 0, 0});
+    const std::uint32_t lower_node = build_node(first, upper);
+    const std::uint32_t upper_node = build_node(upper, last);
+    nodes_[node].lower = lower_node;
+    nodes_[node].upper = upper_node;
+    return node;
+  }
+
+  /**
+   * @brief Splits full leaf <code>node</code> to make room for point <code>index</code>
+   */
+  inline void split_leaf(const std::uint32_t node, const std::uint32_t index)
+  {
+    const Leaf& leaf = leaves_[nodes_[node].leaf_index()];
+    std::array<std::uint32_t, BUCKET_SIZE + 1> items;
+    std::copy(leaf.items.begin(), leaf.items.end(), items.begin());
+    items[BUCKET_SIZE] = index;
+
+    const std::uint32_t dim = widest_dim(items.data(), items.data() + items.size());
+    const auto [split, upper] = partition(items.data(), items.data() + items.size(), dim);
+
+    std::uint32_t* const first = items.data();
+    std::uint32_t* const last = items.data() + items.size();
+
+    // Reuse full leaf for lower partition
+    const std::uint32_t lower_leaf = nodes_[node].leaf_index();
+    Leaf& lower = leaves_[lower_leaf];
+    lower.count = static_cast<std::uint32_t>(std::copy(first, upper, lower.items.begin()) - lower.items.begin());
+    const std::uint32_t lower_node = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.push_back(Node::leaf(lower_leaf));
+
+    const std::uint32_t upper_node = add_leaf(upper, last);
+    nodes_[node] = Node{split, dim, lower_node, upper_node};
+  }
+
+  /**
+   * @brief Updates <code>best</code> with nearest point in subtree rooted at <code>node</code>
+   */
+  void search_nearest(const std::uint32_t node, const Point<Dim>& query, Neighbor& best) const
+  {
+    const Node& n = nodes_[node];
+    if (n.is_leaf())
+    {
+      const Leaf& leaf = leaves_[n.leaf_index()];
+      for (std::uint32_t i = 0; i < leaf.count; ++i)
+      {
+        const double d2 = squared_distance(query, points_[leaf.items[i]]);
+        if (d2 < best.squared_distance)
+        {
+          best = Neighbor{d2, leaf.items[i]};
+        }
+      }
+      return;
+    }
+
+    const double delta = query[n.dim] - n.split;
+    const bool lower_first = delta < 0.0;
+    search_nearest(lower_first ? n.lower : n.upper, query, best);
+    if (delta * delta <= best.squared_distance)
+    {
+      search_nearest(lower_first ? n.upper : n.lower, query, best);
+    }
+  }
+
+  /**
+   * @brief Fills <code>heap</code> with up to <code>k</code> nearest points, sorted nearest first
+   */
+  inline void search_nearest_k(const Point<Dim>& query, const std::size_t k, std::vector<Neighbor>& heap) const
+  {
+    heap.clear();
+    if (k > 0)
+    {
+      search_nearest_k(0, query, k, heap);
+    }
+    std::sort_heap(heap.begin(), heap.end());
+  }
+
+  /**
+   * @brief Adds nearest points in subtree rooted at <code>node</code> to max-heap <code>heap</code> of up to
+   *        <code>k</code> candidates
+   */
+  void search_nearest_k(
+    const std::uint32_t node,
+    const Point<Dim>& query,
+    const std::size_t k,
+    std::vector<Neighbor>& heap) const
+  {
+    const Node& n = nodes_[node];
+    if (n.is_leaf())
+    {
+      const Leaf& leaf = leaves_[n.leaf_index()];
+      for (std::uint32_t i = 0; i < leaf.count; ++i)
+      {
+        const double d2 = squared_distance(query, points_[leaf.items[i]]);
+        if (heap.size() < k)
+        {
+          heap.push_back(Neighbor{d2, leaf.items[i]});
+          std::push_heap(heap.begin(), heap.end());
+        }
+        else if (d2 < heap.front().squared_distance)
+        {
+          std::pop_heap(heap.begin(), heap.end());
+          heap.back() = Neighbor{d2, leaf.items[i]};
+          std::push_heap(heap.begin(), heap.end());
+        }
+      }
+      return;
+    }
+
+    const double delta = query[n.dim] - n.split;
+    const bool lower_first = delta < 0.0;
+    search_nearest_k(lower_first ? n.lower : n.upper, query, k, heap);
+    if (heap.size() < k or delta * delta <= heap.front().squared_distance)
+    {
+      search_nearest_k(lower_first ? n.upper : n.lower, query, k, heap);
+    }
+  }
+
+  /**
+   * @brief Adds points in subtree rooted at <code>node</code> within squared radius of <code>query</code>
+   */
+  void search_radius(
+    const std::uint32_t node,
+    const Point<Dim>& query,
+    const double squared_radius,
+    std::vector<std::uint32_t>& indices) const
+  {
+    const Node& n = nodes_[node];
+    if (n.is_leaf())
+    {
+      const Leaf& leaf = leaves_[n.leaf_index()];
+      for (std::uint32_t i = 0; i < leaf.count; ++i)
+      {
+        if (squared_distance(query, points_[leaf.items[i]]) <= squared_radius)
+        {
+          indices.push_back(leaf.items[i]);
+        }
+      }
+      return;
+    }
+
+    const double delta = query[n.dim] - n.split;
+    if (delta < 0.0 or delta * delta <= squared_radius)
+    {
+      search_radius(n.lower, query, squared_radius, indices);
+    }
+    if (delta >= 0.0 or delta * delta <= squared_radius)
+    {
+      search_radius(n.upper, query, squared_radius, indices);
+    }
+  }
+
+  /// Points, by insertion index
+  std::vector<Point<Dim>> points_;
+
+  /// Tree nodes; root node is first
+  std::vector<Node> nodes_;
+
+  /// Leaf point index buckets
+  std::vector<Leaf> leaves_;
+};
+
+}  // namespace mmpl::sampling
+
+#endif  // MMPL_SAMPLING_KD_TREE_H
@@ -0,0 +1,257 @@
+#ifndef MMPL_SAMPLING_PRM_H
+#define MMPL_SAMPLING_PRM_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/metric.h>
+#include <mmpl/sampling/configuration.h>
+#include <mmpl/sampling/kd_tree.h>
+#include <mmpl/state_space/csr.h>
+#include <mmpl/support.h>
+#include <mmpl/worker_pool.h>
+
+namespace mmpl::sampling
+{
+
+/**
+ * @brief Probabilistic roadmap (PRM) builder
+ *
+ *        Builds a roadmap over valid sampled configurations, connecting each configuration to its nearest neighbors
+ *        through valid edges, and stores it as a state_space::CsrGraph weighted by <code>MetricT</code>. Roadmaps are
+ *        searched with the usual planners, over state_space::CsrStateSpace and state_space::CsrMetric; vertex indices
+ *        match configuration indices.
+ *
+ *        Each build phase runs in parallel over a WorkerPool:
+ *        - sampling, with one random engine per worker
+ *        - nearest-neighbor queries, as batched KdTree queries over contiguous chunks of configurations
+ *        - edge validity checks and edge values; each undirected edge is checked exactly once
+ *
+ *        <code>StateCheckerT</code> is invoked as <code>bool(const Point<Dim>&)</code> and <code>EdgeCheckerT</code> as
+ *        <code>bool(const Point<Dim>& from, const Point<Dim>& to)</code>; edges are assumed to be symmetric.
+ *
+ * @warn The metric, both checkers and samplers are invoked concurrently from all workers, and must be thread-safe
+ *
+ * @warn Referenced metric must outlive this object
+ */
+template <std::size_t Dim, typename MetricT, typename StateCheckerT, typename EdgeCheckerT> class Prm
+{
+public:
+  using ValueType = metric_value_t<MetricT>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param metric  edge value metric over configurations
+   * @param state_checker  configuration validity check
+   * @param edge_checker  edge validity check
+   * @param thread_count  number of threads used to build roadmaps
+   */
+  Prm(
+    MetricBase<MetricT>& metric,
+    StateCheckerT state_checker,
+    EdgeCheckerT edge_checker,
+    const std::size_t thread_count = std::thread::hardware_concurrency()) :
+      metric_{std::addressof(metric)},
+      state_checker_{std::move(state_checker)},
+      edge_checker_{std::move(edge_checker)},
+      workers_{thread_count},
+      edges_(workers_.size())
+  {}
+
+  /**
+   * @brief Builds a new roadmap, replacing the previous one
+   *
+   * @param sampler  callable invoked as <code>Point<Dim>(std::mt19937_64&)</code>
+   * @param sample_count  number of configurations to sample; invalid samples are rejected
+   * @param neighbor_count  number of nearest neighbors each configuration is connected to
+   * @param seed  random seed; worker <code>i</code> samples with seed <code>seed + i</code>
+   */
+  template <typename SamplerFnT>
+  void build(
+    SamplerFnT&& sampler,
+    const std::size_t sample_count,
+    const std::size_t neighbor_count,
+    const std::uint64_t seed = 0)
+  {
+    const std::size_t worker_count = workers_.size();
+
+    // Sample valid configurations; each worker draws an equal share of samples
+    std::vector<std::vector<Point<Dim>>> samples(worker_count);
+    workers_.run([&](const std::size_t worker_index) {
+      std::mt19937_64 rng{seed + worker_index};
+      const std::size_t share = chunk_end(sample_count, worker_index) - chunk_begin(sample_count, worker_index);
+      for (std::size_t i = 0; i < share; ++i)
+      {
+        const Point<Dim> point = sampler(rng);
+        if (state_checker_(point))
+        {
+          samples[worker_index].push_back(point);
+        }
+      }
+    });
+
+    std::vector<Point<Dim>> points;
+    for (const auto& worker_samples : samples)
+    {
+      points.insert(points.end(), worker_samples.begin(), worker_samples.end());
+    }
+    index_.build(points.begin(), points.end());
+
+    // Find nearest neighbors of all configurations; the nearest of each is itself
+    const std::size_t vertex_count = points.size();
+    const std::size_t k = neighbor_count + 1;
+    neighbors_.resize(vertex_count * k);
+    workers_.run([&](const std::size_t worker_index) {
+      const std::size_t first = chunk_begin(vertex_count, worker_index);
+      const std::size_t last = chunk_end(vertex_count, worker_index);
+      index_.nearest_k(points.data() + first, last - first, k, neighbors_.data() + first * k);
+    });
+
+    // Check each undirected edge once, from the lower index of a mutual neighbor pair
+    workers_.run([&](const std::size_t worker_index) {
+      auto& edges = edges_[worker_index];
+      edges.clear();
+
+      const std::size_t last = chunk_end(vertex_count, worker_index);
+      for (std::size_t v = chunk_begin(vertex_count, worker_index); v < last; ++v)
+      {
+        const std::uint32_t* const v_neighbors = neighbors_.data() + v * k;
+        for (std::size_t j = 0; j < k and v_neighbors[j] != KdTree<Dim>::NO_INDEX; ++j)
+        {
+          const std::uint32_t u = v_neighbors[j];
+          if (u == v or (u < v and is_neighbor(u, static_cast<std::uint32_t>(v), k)))
+          {
+            continue;
+          }
+          else if (edge_checker_(points[v], points[u]))
+          {
+            const Configuration<Dim> from{points[v], static_cast<std::uint32_t>(v)};
+            const Configuration<Dim> to{points[u], u};
+            const ValueType value = (*metric_)(from, to);
+            edges.push_back(state_space::CsrEdge<ValueType>{from.index(), to.index(), value});
+            edges.push_back(state_space::CsrEdge<ValueType>{to.index(), from.index(), value});
+          }
+        }
+      }
+    });
+
+    std::vector<state_space::CsrEdge<ValueType>> all_edges;
+    for (const auto& worker_edges : edges_)
+    {
+      all_edges.insert(all_edges.end(), worker_edges.begin(), worker_edges.end());
+    }
+    graph_ = state_space::CsrGraph<ValueType>{
+      static_cast<std::uint32_t>(vertex_count), all_edges.begin(), all_edges.end()};
+  }
+
+  /**
+   * @brief Returns index of the nearest roadmap configuration which <code>point</code> connects to through a valid
+   *        edge
+   *
+   *        Used to attach query start and goal points to the roadmap
+   *
+   * @param point  query point
+   * @param neighbor_count  number of nearest configurations to try
+   *
+   * @return configuration index; KdTree::NO_INDEX if no configuration could be connected
+   */
+  inline std::uint32_t connect(const Point<Dim>& point, const std::size_t neighbor_count) const
+  {
+    std::vector<std::uint32_t> candidates;
+    index_.nearest_k(point, neighbor_count, candidates);
+    for (const std::uint32_t candidate : candidates)
+    {
+      if (edge_checker_(point, index_.point(candidate)))
+      {
+        return candidate;
+      }
+    }
+    return KdTree<Dim>::NO_INDEX;
+  }
+
+  /**
+   * @brief Returns roadmap graph; vertex indices match configuration indices
+   */
+  inline const state_space::CsrGraph<ValueType>& graph() const { return graph_; }
+
+  /**
+   * @brief Returns nearest-neighbor index over roadmap configurations
+   */
+  inline const KdTree<Dim>& index() const { return index_; }
+
+  /**
+   * @brief Returns roadmap configuration with <code>index</code>
+   */
+  inline Configuration<Dim> configuration(const std::uint32_t index) const
+  {
+    return Configuration<Dim>{index_.point(index), index};
+  }
+
+  /**
+   * @brief Returns number of roadmap configurations
+   */
+  inline std::size_t size() const { return index_.size(); }
+
+private:
+  /**
+   * @brief Returns first item of the chunk of <code>count</code> items processed by worker <code>worker_index</code>
+   */
+  inline std::size_t chunk_begin(const std::size_t count, const std::size_t worker_index) const
+  {
+    return count * worker_index / workers_.size();
+  }
+
+  /**
+   * @brief Returns item one past the chunk of <code>count</code> items processed by worker <code>worker_index</code>
+   */
+  inline std::size_t chunk_end(const std::size_t count, const std::size_t worker_index) const
+  {
+    return count * (worker_index + 1) / workers_.size();
+  }
+
+  /**
+   * @brief Checks if <code>u</code> is among the <code>k</code> nearest neighbors of <code>v</code>
+   */
+  inline bool is_neighbor(const std::uint32_t v, const std::uint32_t u, const std::size_t k) const
+  {
+    const std::uint32_t* const v_neighbors = neighbors_.data() + v * k;
+    return std::find(v_neighbors, v_neighbors + k, u) != v_neighbors + k;
+  }
+
+  /// Edge value metric
+  MetricBase<MetricT>* metric_;
+
+  /// Configuration validity check
+  StateCheckerT state_checker_;
+
+  /// Edge validity check
+  EdgeCheckerT edge_checker_;
+
+  /// Roadmap build workers
+  WorkerPool workers_;
+
+  /// Nearest-neighbor index over roadmap configurations
+  KdTree<Dim> index_;
+
+  /// Nearest neighbors of each configuration, <code>neighbor_count + 1</code> per configuration
+  std::vector<std::uint32_t> neighbors_;
+
+  /// Per-worker valid edges
+  std::vector<std::vector<state_space::CsrEdge<ValueType>>> edges_;
+
+  /// Roadmap graph
+  state_space::CsrGraph<ValueType> graph_;
+};
+
+}  // namespace mmpl::sampling
+
+#endif  // MMPL_SAMPLING_PRM_H
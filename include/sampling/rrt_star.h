@@ -0,0 +1,330 @@
+#ifndef MMPL_SAMPLING_RRT_STAR_H
+#define MMPL_SAMPLING_RRT_STAR_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/metric.h>
+#include <mmpl/sampling/configuration.h>
+#include <mmpl/sampling/kd_tree.h>
+#include <mmpl/support.h>
+#include <mmpl/value.h>
+
+namespace mmpl::sampling
+{
+
+/**
+ * @brief Asymptotically-optimal rapidly-exploring random tree (RRT*)
+ *
+ *        Grows a tree of valid configurations from a root. Each iteration steers from the nearest tree configuration
+ *        toward a random sample by at most <code>step_size</code>; the new configuration is attached to the neighbor
+ *        (within the shrinking RRT* radius) through which it is reached most cheaply, and neighbors which are then
+ *        reached more cheaply through it are rewired. Values of rewired subtrees are updated eagerly, so
+ *        <code>value(i)</code> is always the value of the tree path to configuration <code>i</code>.
+ *
+ *        Edge values are given by <code>MetricT</code>, and neighbors are found with a KdTree which grows with the
+ *        tree. <code>StateCheckerT</code> is invoked as <code>bool(const Point<Dim>&)</code> and
+ *        <code>EdgeCheckerT</code> as <code>bool(const Point<Dim>& from, const Point<Dim>& to)</code>. Edges and their
+ *        values are assumed to be symmetric, and values to be non-negative.
+ *
+ * @warn Referenced metric must outlive this object
+ */
+template <std::size_t Dim, typename MetricT, typename StateCheckerT, typename EdgeCheckerT> class RrtStar
+{
+public:
+  using ValueType = metric_value_t<MetricT>;
+
+  /// Index returned when there is no matching configuration
+  static constexpr std::uint32_t NO_INDEX = KdTree<Dim>::NO_INDEX;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param metric  edge value metric over configurations
+   * @param state_checker  configuration validity check
+   * @param edge_checker  edge validity check
+   * @param step_size  largest distance between a configuration and its parent
+   * @param rewire_factor  RRT* radius constant (gamma); the neighbor radius over <code>n</code> configurations is
+   *                       <code>min(step_size, rewire_factor * (log(n) / n)^(1 / Dim))</code>
+   */
+  RrtStar(
+    MetricBase<MetricT>& metric,
+    StateCheckerT state_checker,
+    EdgeCheckerT edge_checker,
+    const double step_size,
+    const double rewire_factor) :
+      metric_{std::addressof(metric)},
+      state_checker_{std::move(state_checker)},
+      edge_checker_{std::move(edge_checker)},
+      step_size_{step_size},
+      rewire_factor_{rewire_factor}
+  {
+    MMPL_RUNTIME_ASSERT(step_size_ > 0.0);
+  }
+
+  /**
+   * @brief Clears the tree and restarts it from <code>root</code>
+   */
+  inline void reset(const Point<Dim>& root)
+  {
+    index_.clear();
+    parents_.clear();
+    values_.clear();
+    children_.clear();
+    add(root, NO_INDEX, Null<ValueType>::value);
+  }
+
+  /**
+   * @brief Runs a number of RRT* iterations
+   *
+   * @param sampler  callable invoked as <code>Point<Dim>(std::mt19937_64&)</code>
+   * @param rng  random engine passed to <code>sampler</code>
+   * @param iterations  number of samples to draw
+   *
+   * @return number of configurations added to the tree
+   */
+  template <typename SamplerFnT>
+  std::size_t grow(SamplerFnT&& sampler, std::mt19937_64& rng, const std::size_t iterations)
+  {
+    MMPL_RUNTIME_ASSERT(!index_.empty());
+
+    std::size_t added = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      added += extend(sampler(rng));
+    }
+    return added;
+  }
+
+  /**
+   * @brief Returns index of the configuration within <code>tolerance</code> of <code>goal</code> which has the
+   *        smallest value; NO_INDEX if there is none
+   */
+  inline std::uint32_t best_within(const Point<Dim>& goal, const double tolerance) const
+  {
+    std::vector<std::uint32_t> candidates;
+    index_.within_radius(goal, tolerance, candidates);
+
+    std::uint32_t best = NO_INDEX;
+    for (const std::uint32_t candidate : candidates)
+    {
+      if (best == NO_INDEX or values_[candidate] < values_[best])
+      {
+        best = candidate;
+      }
+    }
+    return best;
+  }
+
+  /**
+   * @brief Writes tree path from the root to configuration <code>index</code>, inclusive
+   *
+   * @param index  path terminal configuration index
+   * @param output  output iterator receiving configurations
+   *
+   * @return output iterator one past the last written configuration
+   */
+  template <typename OutputIteratorT> OutputIteratorT path(std::uint32_t index, OutputIteratorT output) const
+  {
+    std::vector<Configuration<Dim>> reversed;
+    for (; index != NO_INDEX; index = parents_[index])
+    {
+      reversed.push_back(configuration(index));
+    }
+    return std::copy(reversed.rbegin(), reversed.rend(), output);
+  }
+
+  /**
+   * @brief Returns tree configuration with <code>index</code>
+   */
+  inline Configuration<Dim> configuration(const std::uint32_t index) const
+  {
+    return Configuration<Dim>{index_.point(index), index};
+  }
+
+  /**
+   * @brief Returns parent index of configuration <code>index</code>; NO_INDEX for the root
+   */
+  inline std::uint32_t parent(const std::uint32_t index) const { return parents_[index]; }
+
+  /**
+   * @brief Returns value of the tree path from the root to configuration <code>index</code>
+   */
+  inline ValueType value(const std::uint32_t index) const { return values_[index]; }
+
+  /**
+   * @brief Returns number of tree configurations
+   */
+  inline std::size_t size() const { return index_.size(); }
+
+  /**
+   * @brief Returns nearest-neighbor index over tree configurations
+   */
+  inline const KdTree<Dim>& index() const { return index_; }
+
+private:
+  /**
+   * @brief Adds configuration at <code>point</code> below <code>parent</code>
+   */
+  inline std::uint32_t add(const Point<Dim>& point, const std::uint32_t parent, const ValueType& value)
+  {
+    const std::uint32_t index = index_.insert(point);
+    parents_.push_back(parent);
+    values_.push_back(value);
+    children_.emplace_back();
+    if (parent != NO_INDEX)
+    {
+      children_[parent].push_back(index);
+    }
+    return index;
+  }
+
+  /**
+   * @brief Returns value of edge between two points
+   */
+  inline ValueType edge_value(const Point<Dim>& from, const Point<Dim>& to)
+  {
+    return (*metric_)(
+      Configuration<Dim>{from, Configuration<Dim>::NO_INDEX}, Configuration<Dim>{to, Configuration<Dim>::NO_INDEX});
+  }
+
+  /**
+   * @brief Runs a single iteration toward <code>sample</code>
+   *
+   * @retval true  if a configuration was added
+   * @retval false  otherwise
+   */
+  bool extend(const Point<Dim>& sample)
+  {
+    // Steer from nearest configuration toward sample
+    const std::uint32_t nearest = index_.nearest(sample);
+    const Point<Dim>& from = index_.point(nearest);
+
+    Point<Dim> point = sample;
+    const double distance = std::sqrt(squared_distance(from, sample));
+    if (distance > step_size_)
+    {
+      for (std::size_t d = 0; d < Dim; ++d)
+      {
+        point[d] = from[d] + (sample[d] - from[d]) * (step_size_ / distance);
+      }
+    }
+
+    if (!state_checker_(point))
+    {
+      return false;
+    }
+
+    // Choose cheapest valid parent among near configurations, falling back to the nearest one
+    const double n = static_cast<double>(index_.size() + 1);
+    const double radius = std::min(step_size_, rewire_factor_ * std::pow(std::log(n) / n, 1.0 / Dim));
+    index_.within_radius(point, radius, near_);
+    if (std::find(near_.begin(), near_.end(), nearest) == near_.end())
+    {
+      near_.push_back(nearest);
+    }
+
+    near_values_.clear();
+    std::uint32_t parent = NO_INDEX;
+    ValueType value = Invalid<ValueType>::value;
+    for (const std::uint32_t candidate : near_)
+    {
+      const ValueType edge = edge_value(index_.point(candidate), point);
+      near_values_.push_back(edge);
+
+      const ValueType candidate_value = values_[candidate] + edge;
+      if (candidate_value < value and edge_checker_(index_.point(candidate), point))
+      {
+        parent = candidate;
+        value = candidate_value;
+      }
+    }
+
+    if (parent == NO_INDEX)
+    {
+      return false;
+    }
+
+    // Rewire neighbors which are reached more cheaply through the new configuration
+    const std::uint32_t added = add(point, parent, value);
+    for (std::size_t i = 0; i < near_.size(); ++i)
+    {
+      const std::uint32_t neighbor = near_[i];
+      const ValueType rewired_value = value + near_values_[i];
+      if (neighbor != parent and rewired_value < values_[neighbor] and edge_checker_(point, index_.point(neighbor)))
+      {
+        reparent(neighbor, added, rewired_value);
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Moves configuration <code>index</code> below <code>parent</code>, and updates values of its subtree
+   */
+  inline void reparent(const std::uint32_t index, const std::uint32_t parent, const ValueType& value)
+  {
+    auto& siblings = children_[parents_[index]];
+    siblings.erase(std::find(siblings.begin(), siblings.end(), index));
+    children_[parent].push_back(index);
+    parents_[index] = parent;
+
+    const ValueType delta = values_[index] - value;
+    stack_.assign(1, index);
+    while (!stack_.empty())
+    {
+      const std::uint32_t current = stack_.back();
+      stack_.pop_back();
+      values_[current] -= delta;
+      stack_.insert(stack_.end(), children_[current].begin(), children_[current].end());
+    }
+  }
+
+  /// Edge value metric
+  MetricBase<MetricT>* metric_;
+
+  /// Configuration validity check
+  StateCheckerT state_checker_;
+
+  /// Edge validity check
+  EdgeCheckerT edge_checker_;
+
+  /// Largest distance between a configuration and its parent
+  double step_size_;
+
+  /// RRT* radius constant
+  double rewire_factor_;
+
+  /// Nearest-neighbor index over tree configurations
+  KdTree<Dim> index_;
+
+  /// Per-configuration parent indices
+  std::vector<std::uint32_t> parents_;
+
+  /// Per-configuration tree path values
+  std::vector<ValueType> values_;
+
+  /// Per-configuration child indices
+  std::vector<std::vector<std::uint32_t>> children_;
+
+  /// Near configuration scratch buffer
+  std::vector<std::uint32_t> near_;
+
+  /// Edge values to near configurations scratch buffer
+  std::vector<ValueType> near_values_;
+
+  /// Subtree traversal scratch buffer
+  std::vector<std::uint32_t> stack_;
+};
+
+}  // namespace mmpl::sampling
+
+#endif  // MMPL_SAMPLING_RRT_STAR_H
@@ -0,0 +1,174 @@
+#ifndef MMPL_STATE_POOL_H
+#define MMPL_STATE_POOL_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// MMPL
+#include <mmpl/state.h>
+#include <mmpl/support.h>
+
+namespace mmpl
+{
+
+/// Dense handle of a state interned in a StatePool
+using StateHandle = std::uint32_t;
+
+
+/// Handle value which refers to no state
+static constexpr StateHandle NO_STATE_HANDLE = std::numeric_limits<StateHandle>::max();
+
+
+/**
+ * @brief Interns states, mapping each distinct state to a dense 32-bit handle
+ *
+ *        Each state is stored exactly once, in a contiguous array indexed by its handle; handles are assigned in order
+ *        of first interning, starting at zero. States are found again through an open-addressing table which holds
+ *        only handles, and compares candidates against the stored states, so no state is ever copied twice.
+ *
+ *        Containers which refer to states by handle (e.g. expansion_queue::Interned, expansion_table::Interned) only
+ *        store 32-bit handles in place of states, which shrinks their entries for heavy state types, and lets them
+ *        keep per-state records in dense arrays.
+ *
+ * @note Handles remain valid until <code>clear</code> is called
+ */
+template <typename StateT, typename HashT = state_default_hash_t<StateT>> class StatePool
+{
+public:
+  StatePool() { rehash(MIN_SLOT_BITS); }
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param reserved  number of states to reserve space for
+   */
+  explicit StatePool(const std::size_t reserved)
+  {
+    std::size_t slot_bits = MIN_SLOT_BITS;
+    while ((std::size_t{1} << slot_bits) < 2 * reserved)
+    {
+      ++slot_bits;
+    }
+    states_.reserve(reserved);
+    rehash(slot_bits);
+  }
+
+  /**
+   * @brief Returns handle of <code>state</code>, interning it if it was not seen before
+   */
+  inline StateHandle intern(const StateT& state)
+  {
+    const std::size_t slot = probe(state);
+    if (slots_[slot] != NO_STATE_HANDLE)
+    {
+      return slots_[slot];
+    }
+
+    MMPL_RUNTIME_ASSERT(states_.size() < NO_STATE_HANDLE);
+    const StateHandle handle = static_cast<StateHandle>(states_.size());
+    states_.push_back(state);
+    slots_[slot] = handle;
+
+    // Keep table at most half full
+    if (2 * states_.size() > slots_.size())
+    {
+      rehash(slot_bits_ + 1);
+    }
+    return handle;
+  }
+
+  /**
+   * @brief Returns handle of <code>state</code>; NO_STATE_HANDLE if it was never interned
+   */
+  inline StateHandle find(const StateT& state) const { return slots_[probe(state)]; }
+
+  /**
+   * @brief Returns state with handle <code>handle</code>
+   */
+  inline const StateT& state(const StateHandle handle) const
+  {
+    MMPL_RUNTIME_ASSERT(handle < states_.size());
+    return states_[handle];
+  }
+
+  /**
+   * @brief Returns number of interned states; all handles are less than this
+   */
+  inline std::size_t size() const { return states_.size(); }
+
+  /**
+   * @brief Removes all states, invalidating all handles
+   */
+  inline void clear()
+  {
+    states_.clear();
+    std::fill(slots_.begin(), slots_.end(), NO_STATE_HANDLE);
+  }
+
+private:
+  /// Smallest number of table slots, as a power of two
+  static constexpr std::size_t MIN_SLOT_BITS = 6;
+
+  /**
+   * @brief Returns first table slot probed for <code>state</code>
+   *
+   *        State hashes are often plain IDs, so they are spread over the table by Fibonacci hashing
+   */
+  inline std::size_t home_slot(const StateT& state) const
+  {
+    return static_cast<std::size_t>(
+      (static_cast<std::uint64_t>(HashT{}(state)) * 0x9E3779B97F4A7C15ULL) >> (64 - slot_bits_));
+  }
+
+  /**
+   * @brief Returns table slot holding the handle of <code>state</code>, or the empty slot where it belongs
+   */
+  inline std::size_t probe(const StateT& state) const
+  {
+    const std::size_t mask = slots_.size() - 1;
+    for (std::size_t slot = home_slot(state);; slot = (slot + 1) & mask)
+    {
+      const StateHandle handle = slots_[slot];
+      if (handle == NO_STATE_HANDLE or states_[handle] == state)
+      {
+        return slot;
+      }
+    }
+  }
+
+  /**
+   * @brief Rebuilds table with <code>2^slot_bits</code> slots
+   */
+  inline void rehash(const std::size_t slot_bits)
+  {
+    slot_bits_ = slot_bits;
+    slots_.assign(std::size_t{1} << slot_bits, NO_STATE_HANDLE);
+    const std::size_t mask = slots_.size() - 1;
+    for (StateHandle handle = 0; handle < states_.size(); ++handle)
+    {
+      std::size_t slot = home_slot(states_[handle]);
+      while (slots_[slot] != NO_STATE_HANDLE)
+      {
+        slot = (slot + 1) & mask;
+      }
+      slots_[slot] = handle;
+    }
+  }
+
+  /// Interned states, indexed by handle
+  std::vector<StateT> states_;
+
+  /// Open-addressing table of state handles
+  std::vector<StateHandle> slots_;
+
+  /// Number of table slots, as a power of two
+  std::size_t slot_bits_;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_STATE_POOL_H
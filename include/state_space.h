@@ -2,7 +2,10 @@
 #define MMPL_STATE_SPACE_H
 
 // C++ Standard Library
+#include <array>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 // MMPL
 #include <mmpl/crtp.h>
@@ -19,6 +22,43 @@ template <typename T> struct StateSpaceTraits;
 template <typename StateSpaceT> using state_space_state_t = typename StateSpaceTraits<StateSpaceT>::StateType;
 
 
+/**
+ * @brief Number of children per block emitted by a batched state space
+ *
+ *        State spaces which implement <code>for_each_child_block_impl</code> declare
+ *        <code>StateSpaceTraits::child_block_size</code>; this is zero for all other state spaces
+ */
+template <typename StateSpaceT, typename = void>
+struct state_space_child_block_size : std::integral_constant<std::size_t, 0>
+{};
+
+
+template <typename StateSpaceT>
+struct state_space_child_block_size<StateSpaceT, std::void_t<decltype(StateSpaceTraits<StateSpaceT>::child_block_size)>>
+    : std::integral_constant<std::size_t, StateSpaceTraits<StateSpaceT>::child_block_size>
+{};
+
+
+/**
+ * @brief Fixed-capacity block of child states emitted together by a batched state space
+ *
+ *        Children are stored contiguously so that per-child values may be computed in a single vectorizable pass
+ *
+ * @note <code>StateT</code> must be default constructible
+ */
+template <typename StateT, std::size_t N> struct ChildBlock
+{
+  /// Maximum number of child states held by a block
+  static constexpr std::size_t capacity = N;
+
+  /// Child states; only the first <code>size</code> states are valid
+  std::array<StateT, N> states;
+
+  /// Number of valid child states
+  std::size_t size = 0;
+};
+
+
 template <typename DerivedT> class StateSpaceBase
 {
 public:
@@ -29,6 +69,24 @@ public:
     return this->derived()->for_each_child_impl(parent, std::forward<UnaryChildFn>(child_fn));
   }
 
+  /**
+   * @brief Batched counterpart of <code>for_each_child</code>
+   *
+   *        Invokes <code>block_fn</code> with one or more ChildBlock objects holding all children of
+   *        <code>parent</code>. Only available on state spaces which declare
+   *        <code>StateSpaceTraits::child_block_size</code>.
+   *
+   * @param parent  parent state
+   * @param block_fn  callable invoked as <code>block_fn(const ChildBlock<StateType, child_block_size>&)</code>
+   */
+  template <typename UnaryBlockFn> inline bool for_each_child_block(const StateType& parent, UnaryBlockFn&& block_fn)
+  {
+    static_assert(
+      state_space_child_block_size<DerivedT>::value > 0,
+      MMPL_STATIC_ASSERT_MSG("StateSpaceTraits::child_block_size must be declared to use batched child expansion"));
+    return this->derived()->for_each_child_block_impl(parent, std::forward<UnaryBlockFn>(block_fn));
+  }
+
 private:
   IMPLEMENT_CRTP_BASE_CLASS(StateSpaceBase, DerivedT);
 };
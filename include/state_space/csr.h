@@ -0,0 +1,296 @@
+#ifndef MMPL_STATE_SPACE_CSR_H
+#define MMPL_STATE_SPACE_CSR_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+// MMPL
+#include <mmpl/metric.h>
+#include <mmpl/state.h>
+#include <mmpl/state_space.h>
+#include <mmpl/support.h>
+
+namespace mmpl::state_space
+{
+
+class CsrVertex;
+
+template <typename ValueT> class CsrStateSpace;
+
+template <typename ValueT> class CsrMetric;
+
+}  // namespace mmpl::state_space
+
+namespace mmpl
+{
+
+template <> struct StateTraits<state_space::CsrVertex>
+{
+  using IDType = std::uint32_t;
+};
+
+
+template <typename ValueT> struct StateSpaceTraits<state_space::CsrStateSpace<ValueT>>
+{
+  using StateType = state_space::CsrVertex;
+};
+
+
+template <typename ValueT> struct MetricTraits<state_space::CsrMetric<ValueT>>
+{
+  using StateType = state_space::CsrVertex;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::state_space
+{
+
+/**
+ * @brief Vertex of an explicit graph stored in compressed sparse row (CSR) form
+ *
+ *        Vertices are identified by a dense vertex index. Vertices generated by CsrStateSpace additionally carry the
+ *        index of the edge through which they were reached, which allows CsrMetric to look up edge weights directly.
+ *        The edge index does not participate in state identity.
+ */
+class CsrVertex : public StateBase<CsrVertex>
+{
+public:
+  /// Edge index associated with vertices which were not reached through an edge (e.g. search roots)
+  static constexpr std::uint32_t NO_EDGE = std::numeric_limits<std::uint32_t>::max();
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param _vertex  dense vertex index
+   * @param _edge  index of edge through which vertex was reached
+   */
+  constexpr explicit CsrVertex(std::uint32_t _vertex, std::uint32_t _edge = NO_EDGE) : vertex_{_vertex}, edge_{_edge}
+  {}
+
+  /**
+   * @brief Returns dense vertex index
+   */
+  constexpr std::uint32_t vertex() const { return vertex_; }
+
+  /**
+   * @brief Returns index of edge through which this vertex was reached
+   */
+  constexpr std::uint32_t edge() const { return edge_; }
+
+private:
+  /// Dense vertex index
+  std::uint32_t vertex_;
+
+  /// Index of edge through which vertex was reached
+  std::uint32_t edge_;
+
+  /**
+   * @copydoc StateBase::id
+   */
+  inline std::uint32_t id_impl() const { return vertex_; }
+
+  /**
+   * @copydoc StateBase::operator==
+   */
+  inline bool equals_impl(const CsrVertex& other) const { return this->vertex_ == other.vertex_; }
+
+  friend inline std::ostream& operator<<(std::ostream& os, const CsrVertex& state)
+  {
+    return os << '(' << state.vertex_ << ')';
+  }
+
+  friend class StateBase<CsrVertex>;
+};
+
+
+/**
+ * @brief Directed edge used to build a CsrGraph
+ */
+template <typename ValueT> struct CsrEdge
+{
+  /// Source vertex index
+  std::uint32_t source;
+
+  /// Target vertex index
+  std::uint32_t target;
+
+  /// Edge weight
+  ValueT weight;
+};
+
+
+/**
+ * @brief Explicit directed graph stored in compressed sparse row (CSR) form
+ *
+ *        Outgoing edges of vertex <code>v</code> occupy the contiguous range <code>[offsets[v], offsets[v + 1])</code>
+ *        of the target and weight arrays.
+ */
+template <typename ValueT> class CsrGraph
+{
+public:
+  CsrGraph() = default;
+
+  /**
+   * @brief Builds graph from an edge list
+   *
+   *        Edges with the same source vertex keep their relative input order.
+   *
+   * @param vertex_count  number of vertices in the graph
+   * @param first  iterator to first edge (CsrEdge) in list; must be a multi-pass (forward) iterator
+   * @param last  iterator one past last edge in list
+   */
+  template <typename EdgeIteratorT>
+  CsrGraph(const std::uint32_t vertex_count, EdgeIteratorT first, EdgeIteratorT last) : offsets_(vertex_count + 1, 0)
+  {
+    // Count out-degree of each vertex
+    for (auto itr = first; itr != last; ++itr)
+    {
+      MMPL_RUNTIME_ASSERT(itr->source < vertex_count);
+      MMPL_RUNTIME_ASSERT(itr->target < vertex_count);
+      ++offsets_[itr->source + 1];
+    }
+
+    // Convert out-degrees to edge offsets
+    for (std::uint32_t v = 0; v < vertex_count; ++v)
+    {
+      offsets_[v + 1] += offsets_[v];
+    }
+
+    targets_.resize(offsets_.back());
+    weights_.resize(offsets_.back());
+
+    // Scatter edges into their source vertex ranges
+    std::vector<std::uint32_t> cursors{offsets_.begin(), offsets_.end() - 1};
+    for (auto itr = first; itr != last; ++itr)
+    {
+      const std::uint32_t e = cursors[itr->source]++;
+      targets_[e] = itr->target;
+      weights_[e] = itr->weight;
+    }
+  }
+
+  /**
+   * @brief Returns number of vertices in the graph
+   */
+  inline std::uint32_t vertex_count() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+  /**
+   * @brief Returns number of vertices in the graph
+   *
+   * @note Along with <code>state</code>, lets the graph act as a dense state indexer
+   */
+  inline std::size_t size() const { return vertex_count(); }
+
+  /**
+   * @brief Returns vertex state with index <code>v</code>
+   */
+  inline CsrVertex state(const std::uint32_t v) const { return CsrVertex{v}; }
+
+  /**
+   * @brief Returns number of edges in the graph
+   */
+  inline std::uint32_t edge_count() const { return targets_.size(); }
+
+  /**
+   * @brief Returns index of first outgoing edge of vertex <code>v</code>
+   */
+  inline std::uint32_t edges_begin(const std::uint32_t v) const { return offsets_[v]; }
+
+  /**
+   * @brief Returns index one past the last outgoing edge of vertex <code>v</code>
+   */
+  inline std::uint32_t edges_end(const std::uint32_t v) const { return offsets_[v + 1]; }
+
+  /**
+   * @brief Returns target vertex index of edge <code>e</code>
+   */
+  inline std::uint32_t target(const std::uint32_t e) const { return targets_[e]; }
+
+  /**
+   * @brief Returns weight of edge <code>e</code>
+   */
+  inline const ValueT& weight(const std::uint32_t e) const { return weights_[e]; }
+
+private:
+  /// Per-vertex offsets into edge arrays
+  std::vector<std::uint32_t> offsets_;
+
+  /// Per-edge target vertex indices
+  std::vector<std::uint32_t> targets_;
+
+  /// Per-edge weights
+  std::vector<ValueT> weights_;
+};
+
+
+/**
+ * @brief State space over the vertices of a CsrGraph
+ *
+ *        Children of a vertex are generated by a linear scan over its contiguous outgoing edge range.
+ *
+ * @warn Referenced graph must outlive this object
+ */
+template <typename ValueT> class CsrStateSpace : public StateSpaceBase<CsrStateSpace<ValueT>>
+{
+public:
+  explicit CsrStateSpace(const CsrGraph<ValueT>& graph) : graph_{std::addressof(graph)} {}
+
+private:
+  /// Graph being searched
+  const CsrGraph<ValueT>* graph_;
+
+  /**
+   * @copydoc StateSpaceBase::for_each_child
+   */
+  template <typename UnaryChildFn> inline bool for_each_child_impl(const CsrVertex& parent, UnaryChildFn&& child_fn)
+  {
+    const std::uint32_t last = graph_->edges_end(parent.vertex());
+    for (std::uint32_t e = graph_->edges_begin(parent.vertex()); e != last; ++e)
+    {
+      child_fn(CsrVertex{graph_->target(e), e});
+    }
+    return true;
+  }
+
+  friend class StateSpaceBase<CsrStateSpace<ValueT>>;
+};
+
+
+/**
+ * @brief Metric which reads stored CsrGraph edge weights
+ *
+ *        Uses the edge index carried by <code>child</code> states generated through CsrStateSpace.
+ *
+ * @warn Referenced graph must outlive this object
+ */
+template <typename ValueT> class CsrMetric : public MetricBase<CsrMetric<ValueT>>
+{
+public:
+  explicit CsrMetric(const CsrGraph<ValueT>& graph) : graph_{std::addressof(graph)} {}
+
+private:
+  /// Graph providing edge weights
+  const CsrGraph<ValueT>* graph_;
+
+  /**
+   * @copydoc MetricBase::get_value
+   */
+  inline ValueT get_value_impl([[maybe_unused]] const CsrVertex& parent, const CsrVertex& child) const
+  {
+    MMPL_RUNTIME_ASSERT(child.edge() != CsrVertex::NO_EDGE);
+    return graph_->weight(child.edge());
+  }
+
+  friend class MetricBase<CsrMetric<ValueT>>;
+};
+
+}  // namespace mmpl::state_space
+
+#endif  // MMPL_STATE_SPACE_CSR_H
@@ -0,0 +1,155 @@
+#ifndef MMPL_STATE_SPACE_GRID_H
+#define MMPL_STATE_SPACE_GRID_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/neighborhood.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/state_space.h>
+
+namespace mmpl::state_space
+{
+
+template <std::size_t Dim, std::size_t Connectivity> class Grid;
+
+}  // namespace mmpl::state_space
+
+namespace mmpl
+{
+
+template <std::size_t Dim, std::size_t Connectivity> struct StateSpaceTraits<state_space::Grid<Dim, Connectivity>>
+{
+  using StateType = grid::Cell<Dim>;
+  static constexpr std::size_t child_block_size = Connectivity;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::state_space
+{
+
+/**
+ * @brief State space over the free cells of an occupancy grid
+ *
+ *        Children of a cell are its free neighbors under <code>grid::Neighborhood<Dim, Connectivity></code>. Linear
+ *        index offsets of all neighbors are computed once from the layout, and the occupied layout border stands in
+ *        for bounds checks, so each neighbor costs a single bit test (8-connected 2D grids test all neighbors at once
+ *        with <code>grid::Occupancy::free_neighbors</code>). Diagonal moves are allowed whenever the target cell is
+ *        free.
+ *
+ *        Child cell IDs are their linear layout indices, so dense tables indexed by the layout (e.g.
+ *        expansion_table::DenseAtomic) may be used with this state space.
+ *
+ * @warn Referenced occupancy grid must outlive this object
+ */
+template <std::size_t Dim, std::size_t Connectivity> class Grid : public StateSpaceBase<Grid<Dim, Connectivity>>
+{
+public:
+  /// Neighbor offsets, in direction-code order
+  using NeighborhoodType = grid::Neighborhood<Dim, Connectivity>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param occupancy  occupancy grid; changes to occupancy are visible to this state space
+   */
+  explicit Grid(const grid::Occupancy<Dim>& occupancy) : occupancy_{std::addressof(occupancy)}
+  {
+    for (std::size_t code = 0; code < Connectivity; ++code)
+    {
+      index_offsets_[code] = occupancy.layout().offset(NeighborhoodType::offsets[code]);
+    }
+  }
+
+  /**
+   * @brief Returns underlying occupancy grid
+   */
+  inline const grid::Occupancy<Dim>& occupancy() const { return *occupancy_; }
+
+private:
+  /**
+   * @brief Returns neighbor of <code>cell</code> in direction <code>code</code>
+   */
+  inline grid::Cell<Dim> neighbor(const grid::Cell<Dim>& cell, const std::size_t code) const
+  {
+    grid::Coordinates<Dim> coordinates = cell.coordinates();
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      coordinates[d] += NeighborhoodType::offsets[code][d];
+    }
+    return grid::Cell<Dim>{
+      coordinates, static_cast<std::uint32_t>(static_cast<std::int32_t>(cell.index()) + index_offsets_[code])};
+  }
+
+  /**
+   * @brief Invokes <code>code_fn</code> with the direction code of each free neighbor of <code>cell</code>
+   */
+  template <typename UnaryCodeFn> inline void for_each_free_code(const grid::Cell<Dim>& cell, UnaryCodeFn&& code_fn)
+  {
+    if constexpr (Dim == 2 and Connectivity == 8)
+    {
+      const std::uint8_t mask = occupancy_->free_neighbors(cell);
+      for (std::size_t code = 0; code < Connectivity; ++code)
+      {
+        if (mask & (1U << code))
+        {
+          code_fn(code);
+        }
+      }
+    }
+    else
+    {
+      const grid::Bitmap& occupied = occupancy_->bitmap();
+      for (std::size_t code = 0; code < Connectivity; ++code)
+      {
+        const auto index = static_cast<std::uint32_t>(static_cast<std::int32_t>(cell.index()) + index_offsets_[code]);
+        if (!occupied.test(index))
+        {
+          code_fn(code);
+        }
+      }
+    }
+  }
+
+  /**
+   * @copydoc StateSpaceBase::for_each_child
+   */
+  template <typename UnaryChildFn>
+  inline bool for_each_child_impl(const grid::Cell<Dim>& parent, UnaryChildFn&& child_fn)
+  {
+    for_each_free_code(
+      parent, [this, &parent, &child_fn](const std::size_t code) { child_fn(neighbor(parent, code)); });
+    return true;
+  }
+
+  /**
+   * @copydoc StateSpaceBase::for_each_child_block
+   */
+  template <typename UnaryBlockFn>
+  inline bool for_each_child_block_impl(const grid::Cell<Dim>& parent, UnaryBlockFn&& block_fn)
+  {
+    ChildBlock<grid::Cell<Dim>, Connectivity> block;
+    for_each_free_code(
+      parent, [this, &parent, &block](const std::size_t code) { block.states[block.size++] = neighbor(parent, code); });
+    block_fn(block);
+    return true;
+  }
+
+  /// Occupancy grid
+  const grid::Occupancy<Dim>* occupancy_;
+
+  /// Linear index offsets of neighbors, in direction-code order
+  std::array<std::int32_t, Connectivity> index_offsets_;
+
+  friend class StateSpaceBase<Grid<Dim, Connectivity>>;
+};
+
+}  // namespace mmpl::state_space
+
+#endif  // MMPL_STATE_SPACE_GRID_H
@@ -0,0 +1,562 @@
+#ifndef MMPL_STATE_SPACE_LATTICE_H
+#define MMPL_STATE_SPACE_LATTICE_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/grid/cell.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/metric.h>
+#include <mmpl/state.h>
+#include <mmpl/state_space.h>
+#include <mmpl/support.h>
+#include <mmpl/value.h>
+
+namespace mmpl::state_space
+{
+
+class LatticeState;
+
+template <typename ValueT> class Lattice;
+
+template <typename ValueT> class LatticeMetric;
+
+}  // namespace mmpl::state_space
+
+namespace mmpl
+{
+
+template <> struct StateTraits<state_space::LatticeState>
+{
+  using IDType = std::uint64_t;
+};
+
+
+template <typename ValueT> struct StateSpaceTraits<state_space::Lattice<ValueT>>
+{
+  using StateType = state_space::LatticeState;
+};
+
+
+template <typename ValueT> struct MetricTraits<state_space::LatticeMetric<ValueT>>
+{
+  using StateType = state_space::LatticeState;
+  using ValueType = ValueT;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::state_space
+{
+
+/**
+ * @brief Discretized SE(2) pose: a 2D grid cell and one of a fixed number of headings
+ *
+ *        States generated by Lattice additionally carry the index of the motion primitive through which they were
+ *        reached, which allows LatticeMetric to look up cached primitive values directly. The primitive index does
+ *        not participate in state identity, so it is only a hint: states rebuilt from an expansion table may carry
+ *        the index of another primitive, or none at all.
+ */
+class LatticeState : public StateBase<LatticeState>
+{
+public:
+  /// Primitive index associated with states which were not reached through a primitive (e.g. search roots)
+  static constexpr std::uint32_t NO_PRIMITIVE = std::numeric_limits<std::uint32_t>::max();
+
+  LatticeState() = default;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param _cell  grid cell
+   * @param _heading  heading index
+   * @param _primitive  index of primitive through which state was reached
+   */
+  constexpr LatticeState(
+    const grid::Cell<2>& _cell,
+    const std::uint8_t _heading,
+    const std::uint32_t _primitive = NO_PRIMITIVE) :
+      cell_{_cell},
+      heading_{_heading},
+      primitive_{_primitive}
+  {}
+
+  /**
+   * @brief Returns grid cell
+   */
+  constexpr const grid::Cell<2>& cell() const { return cell_; }
+
+  /**
+   * @brief Returns heading index
+   */
+  constexpr std::uint8_t heading() const { return heading_; }
+
+  /**
+   * @brief Returns index of primitive through which this state was reached
+   */
+  constexpr std::uint32_t primitive() const { return primitive_; }
+
+private:
+  /// Grid cell
+  grid::Cell<2> cell_;
+
+  /// Heading index
+  std::uint8_t heading_;
+
+  /// Index of primitive through which state was reached
+  std::uint32_t primitive_;
+
+  /**
+   * @copydoc StateBase::id
+   */
+  inline std::uint64_t id_impl() const { return (static_cast<std::uint64_t>(cell_.index()) << 8) | heading_; }
+
+  /**
+   * @copydoc StateBase::operator==
+   */
+  inline bool equals_impl(const LatticeState& other) const
+  {
+    return this->heading_ == other.heading_ and this->cell_ == other.cell_;
+  }
+
+  friend inline std::ostream& operator<<(std::ostream& os, const LatticeState& state)
+  {
+    return os << state.cell_ << ':' << static_cast<int>(state.heading_);
+  }
+
+  friend class StateBase<LatticeState>;
+};
+
+
+/**
+ * @brief Kinematically feasible motion between two lattice poses
+ *
+ *        Offsets are relative to the start cell of the motion
+ */
+template <typename ValueT> struct MotionPrimitive
+{
+  /// Heading index at start of motion
+  std::uint8_t start_heading;
+
+  /// Offset of end cell
+  grid::Coordinates<2> end_offset;
+
+  /// Heading index at end of motion
+  std::uint8_t end_heading;
+
+  /// Offsets of all cells swept by the motion, excluding the start cell
+  std::vector<grid::Coordinates<2>> swept;
+
+  /// Value of motion
+  ValueT value;
+};
+
+
+/**
+ * @brief Generates a motion primitive along a cubic Hermite curve between two poses
+ *
+ *        The curve leaves the start cell center along the start heading and reaches the end cell center along the
+ *        end heading. Swept cells are found by densely sampling the curve; where consecutive samples fall in
+ *        diagonally adjacent cells, both cells sharing their corner are also swept. The primitive value is the curve
+ *        length, in cell units, multiplied by <code>value_scale</code> (rounded for integral value types).
+ *
+ * @param heading_count  number of headings, evenly spaced from heading zero along the +x axis
+ * @param start_heading  heading index at start of motion
+ * @param end_offset  offset of end cell
+ * @param end_heading  heading index at end of motion
+ * @param value_scale  multiplier applied to curve length
+ */
+template <typename ValueT>
+MotionPrimitive<ValueT> make_primitive(
+  const std::uint8_t heading_count,
+  const std::uint8_t start_heading,
+  const grid::Coordinates<2>& end_offset,
+  const std::uint8_t end_heading,
+  const double value_scale = 1.0)
+{
+  constexpr double two_pi = 6.283185307179586;
+
+  const double theta_0 = two_pi * start_heading / heading_count;
+  const double theta_1 = two_pi * end_heading / heading_count;
+  const double chord = std::hypot(end_offset[0], end_offset[1]);
+  MMPL_RUNTIME_ASSERT(chord > 0.0);
+
+  MotionPrimitive<ValueT> primitive{start_heading, end_offset, end_heading, {}, Null<ValueT>::value};
+
+  const std::size_t samples = 16 * static_cast<std::size_t>(std::ceil(chord));
+
+  double length = 0.0;
+  double prev_x = 0.0;
+  double prev_y = 0.0;
+  grid::Coordinates<2> prev_cell{0, 0};
+  for (std::size_t k = 1; k <= samples; ++k)
+  {
+    const double t = static_cast<double>(k) / samples;
+    const double h01 = t * t * (3.0 - 2.0 * t);
+    const double h10 = t * (1.0 - t) * (1.0 - t);
+    const double h11 = t * t * (t - 1.0);
+    const double x = h01 * end_offset[0] + chord * (h10 * std::cos(theta_0) + h11 * std::cos(theta_1));
+    const double y = h01 * end_offset[1] + chord * (h10 * std::sin(theta_0) + h11 * std::sin(theta_1));
+
+    length += std::hypot(x - prev_x, y - prev_y);
+    prev_x = x;
+    prev_y = y;
+
+    const grid::Coordinates<2> cell{
+      static_cast<std::int32_t>(std::lround(x)), static_cast<std::int32_t>(std::lround(y))};
+    if (cell == prev_cell)
+    {
+      continue;
+    }
+    else if (cell[0] != prev_cell[0] and cell[1] != prev_cell[1])
+    {
+      primitive.swept.push_back({cell[0], prev_cell[1]});
+      primitive.swept.push_back({prev_cell[0], cell[1]});
+    }
+    primitive.swept.push_back(cell);
+    prev_cell = cell;
+  }
+
+  if constexpr (std::is_integral<ValueT>())
+  {
+    primitive.value = static_cast<ValueT>(std::lround(length * value_scale));
+  }
+  else
+  {
+    primitive.value = static_cast<ValueT>(length * value_scale);
+  }
+  return primitive;
+}
+
+
+/**
+ * @brief Motion primitives of a lattice, grouped by start heading
+ *
+ *        Primitives starting at heading <code>h</code> have indices in <code>[begin(h), end(h))</code>
+ */
+template <typename ValueT> class PrimitiveSet
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param heading_count  number of headings
+   * @param primitives  motion primitives, in any order
+   */
+  PrimitiveSet(const std::uint8_t heading_count, std::vector<MotionPrimitive<ValueT>> primitives) :
+      heading_count_{heading_count},
+      primitives_{std::move(primitives)},
+      offsets_(heading_count + 1, 0)
+  {
+    std::stable_sort(primitives_.begin(), primitives_.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.start_heading < rhs.start_heading;
+    });
+    for (const auto& primitive : primitives_)
+    {
+      MMPL_RUNTIME_ASSERT(primitive.start_heading < heading_count and primitive.end_heading < heading_count);
+      ++offsets_[primitive.start_heading + 1];
+    }
+    for (std::uint8_t h = 0; h < heading_count; ++h)
+    {
+      offsets_[h + 1] += offsets_[h];
+    }
+  }
+
+  /**
+   * @brief Returns number of headings
+   */
+  inline std::uint8_t heading_count() const { return heading_count_; }
+
+  /**
+   * @brief Returns total number of primitives
+   */
+  inline std::uint32_t size() const { return primitives_.size(); }
+
+  /**
+   * @brief Returns primitive with index <code>i</code>
+   */
+  inline const MotionPrimitive<ValueT>& operator[](const std::uint32_t i) const { return primitives_[i]; }
+
+  /**
+   * @brief Returns index of first primitive starting at <code>heading</code>
+   */
+  inline std::uint32_t begin(const std::uint8_t heading) const { return offsets_[heading]; }
+
+  /**
+   * @brief Returns index one past the last primitive starting at <code>heading</code>
+   */
+  inline std::uint32_t end(const std::uint8_t heading) const { return offsets_[heading + 1]; }
+
+  /**
+   * @brief Checks if primitive <code>i</code> moves from pose <code>parent</code> to pose <code>child</code>
+   */
+  inline bool connects(const std::uint32_t i, const LatticeState& parent, const LatticeState& child) const
+  {
+    const auto& primitive = primitives_[i];
+    return primitive.start_heading == parent.heading() and primitive.end_heading == child.heading() and
+      primitive.end_offset[0] == child.cell()[0] - parent.cell()[0] and
+      primitive.end_offset[1] == child.cell()[1] - parent.cell()[1];
+  }
+
+  /**
+   * @brief Returns index of least-valued primitive which moves from pose <code>parent</code> to pose <code>child</code>
+   *
+   * @return primitive index; LatticeState::NO_PRIMITIVE if no primitive connects the two poses
+   */
+  inline std::uint32_t find(const LatticeState& parent, const LatticeState& child) const
+  {
+    std::uint32_t found = LatticeState::NO_PRIMITIVE;
+    for (std::uint32_t i = begin(parent.heading()); i != end(parent.heading()); ++i)
+    {
+      if (connects(i, parent, child) and (found == LatticeState::NO_PRIMITIVE or
+                                          primitives_[i].value < primitives_[found].value))
+      {
+        found = i;
+      }
+    }
+    return found;
+  }
+
+private:
+  /// Number of headings
+  std::uint8_t heading_count_;
+
+  /// Primitives, sorted by start heading
+  std::vector<MotionPrimitive<ValueT>> primitives_;
+
+  /// Per-heading offsets into primitives
+  std::vector<std::uint32_t> offsets_;
+};
+
+
+/**
+ * @brief Returns a primitive set over eight headings, 45 degrees apart
+ *
+ *        From each heading, the set holds a single step straight ahead and two gentle turns to the neighboring
+ *        headings. Primitives of even and odd headings are rotations of each other by multiples of 90 degrees.
+ *
+ * @param value_scale  multiplier applied to primitive lengths
+ */
+template <typename ValueT> PrimitiveSet<ValueT> make_octile_primitive_set(const double value_scale = 1.0)
+{
+  // (end offset, heading change) from headings 0 (+x) and 1 (+x+y)
+  const std::pair<grid::Coordinates<2>, std::int32_t> bases[2][3] = {
+    {{{1, 0}, 0}, {{2, 1}, 1}, {{2, -1}, -1}},
+    {{{1, 1}, 0}, {{1, 2}, 1}, {{2, 1}, -1}},
+  };
+
+  std::vector<MotionPrimitive<ValueT>> primitives;
+  for (std::uint8_t heading = 0; heading < 8; ++heading)
+  {
+    for (const auto& [offset, turn] : bases[heading % 2])
+    {
+      // Rotate base offset by 90 degrees once per pair of headings
+      grid::Coordinates<2> end_offset = offset;
+      for (std::uint8_t r = 0; r < heading / 2; ++r)
+      {
+        end_offset = {-end_offset[1], end_offset[0]};
+      }
+      const auto end_heading = static_cast<std::uint8_t>((heading + turn + 8) % 8);
+      primitives.push_back(make_primitive<ValueT>(8, heading, end_offset, end_heading, value_scale));
+    }
+  }
+  return PrimitiveSet<ValueT>{8, std::move(primitives)};
+}
+
+
+/**
+ * @brief State-lattice state space over an occupancy grid
+ *
+ *        Children of a pose are the end poses of all primitives starting at its heading whose swept cells are all
+ *        free. Swept cell offsets of every primitive are converted to linear index offsets once, up front, and
+ *        stored contiguously, so checking a primitive is a bounding-box test followed by one bitmap probe per swept
+ *        cell.
+ *
+ * @warn Referenced occupancy grid must outlive this object
+ */
+template <typename ValueT> class Lattice : public StateSpaceBase<Lattice<ValueT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param occupancy  occupancy grid; changes to occupancy are visible to this state space
+   * @param primitives  motion primitives
+   */
+  Lattice(const grid::Occupancy<2>& occupancy, const PrimitiveSet<ValueT>& primitives) :
+      occupancy_{std::addressof(occupancy)},
+      heading_count_{primitives.heading_count()},
+      heading_offsets_(primitives.heading_count() + 1),
+      swept_begin_(primitives.size() + 1, 0)
+  {
+    for (std::uint8_t h = 0; h <= heading_count_; ++h)
+    {
+      heading_offsets_[h] = (h < heading_count_) ? primitives.begin(h) : primitives.size();
+    }
+
+    for (std::uint32_t i = 0; i < primitives.size(); ++i)
+    {
+      const auto& primitive = primitives[i];
+
+      Transition transition{primitive.end_offset, occupancy.layout().offset(primitive.end_offset), {0, 0}, {0, 0},
+                            primitive.end_heading};
+      for (const auto& offset : primitive.swept)
+      {
+        swept_offsets_.push_back(occupancy.layout().offset(offset));
+        for (std::size_t d = 0; d < 2; ++d)
+        {
+          transition.min_offset[d] = std::min(transition.min_offset[d], offset[d]);
+          transition.max_offset[d] = std::max(transition.max_offset[d], offset[d]);
+        }
+      }
+      swept_begin_[i + 1] = swept_offsets_.size();
+      transitions_.push_back(transition);
+    }
+  }
+
+  /**
+   * @brief Returns number of headings
+   */
+  inline std::uint8_t heading_count() const { return heading_count_; }
+
+private:
+  /**
+   * @brief Precomputed primitive transition data
+   */
+  struct Transition
+  {
+    /// Offset of end cell
+    grid::Coordinates<2> end_offset;
+
+    /// Linear index offset of end cell
+    std::int32_t end_index_offset;
+
+    /// Smallest swept cell offset along each dimension
+    grid::Coordinates<2> min_offset;
+
+    /// Largest swept cell offset along each dimension
+    grid::Coordinates<2> max_offset;
+
+    /// Heading index at end of motion
+    std::uint8_t end_heading;
+  };
+
+  /**
+   * @brief Checks if all cells swept by primitive <code>i</code> from <code>cell</code> are in bounds and free
+   */
+  inline bool is_free(const grid::Cell<2>& cell, const std::uint32_t i) const
+  {
+    const Transition& transition = transitions_[i];
+    const grid::Coordinates<2>& extents = occupancy_->layout().extents();
+    for (std::size_t d = 0; d < 2; ++d)
+    {
+      if (cell[d] + transition.min_offset[d] < 0 or cell[d] + transition.max_offset[d] >= extents[d])
+      {
+        return false;
+      }
+    }
+
+    const grid::Bitmap& occupied = occupancy_->bitmap();
+    const auto index = static_cast<std::int32_t>(cell.index());
+    for (std::uint32_t s = swept_begin_[i]; s != swept_begin_[i + 1]; ++s)
+    {
+      if (occupied.test(static_cast<std::uint32_t>(index + swept_offsets_[s])))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @copydoc StateSpaceBase::for_each_child
+   */
+  template <typename UnaryChildFn> inline bool for_each_child_impl(const LatticeState& parent, UnaryChildFn&& child_fn)
+  {
+    const grid::Cell<2>& cell = parent.cell();
+    const std::uint32_t last = heading_offsets_[parent.heading() + 1];
+    for (std::uint32_t i = heading_offsets_[parent.heading()]; i != last; ++i)
+    {
+      if (!is_free(cell, i))
+      {
+        continue;
+      }
+
+      const Transition& transition = transitions_[i];
+      const grid::Cell<2> end_cell{
+        {cell[0] + transition.end_offset[0], cell[1] + transition.end_offset[1]},
+        static_cast<std::uint32_t>(static_cast<std::int32_t>(cell.index()) + transition.end_index_offset)};
+      child_fn(LatticeState{end_cell, transition.end_heading, i});
+    }
+    return true;
+  }
+
+  /// Occupancy grid
+  const grid::Occupancy<2>* occupancy_;
+
+  /// Number of headings
+  std::uint8_t heading_count_;
+
+  /// Per-heading offsets into primitive transitions
+  std::vector<std::uint32_t> heading_offsets_;
+
+  /// Per-primitive transition data
+  std::vector<Transition> transitions_;
+
+  /// Per-primitive offsets into swept cell index offsets
+  std::vector<std::uint32_t> swept_begin_;
+
+  /// Linear index offsets of swept cells, for all primitives
+  std::vector<std::int32_t> swept_offsets_;
+
+  friend class StateSpaceBase<Lattice<ValueT>>;
+};
+
+
+/**
+ * @brief Metric which reads cached primitive values
+ *
+ *        Uses the primitive index carried by <code>child</code> states generated through Lattice when it connects
+ *        <code>parent</code> to <code>child</code>; otherwise, the primitive is recovered from the pose pair.
+ *
+ * @warn Referenced primitive set must outlive this object
+ */
+template <typename ValueT> class LatticeMetric : public MetricBase<LatticeMetric<ValueT>>
+{
+public:
+  explicit LatticeMetric(const PrimitiveSet<ValueT>& primitives) : primitives_{std::addressof(primitives)} {}
+
+private:
+  /// Primitives providing values
+  const PrimitiveSet<ValueT>* primitives_;
+
+  /**
+   * @copydoc MetricBase::get_value
+   */
+  inline ValueT get_value_impl(const LatticeState& parent, const LatticeState& child) const
+  {
+    std::uint32_t i = child.primitive();
+    if (i == LatticeState::NO_PRIMITIVE or !primitives_->connects(i, parent, child))
+    {
+      i = primitives_->find(parent, child);
+    }
+    MMPL_RUNTIME_ASSERT(i != LatticeState::NO_PRIMITIVE);
+    return (*primitives_)[i].value;
+  }
+
+  friend class MetricBase<LatticeMetric<ValueT>>;
+};
+
+}  // namespace mmpl::state_space
+
+#endif  // MMPL_STATE_SPACE_LATTICE_H
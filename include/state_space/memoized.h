@@ -0,0 +1,207 @@
+#ifndef MMPL_STATE_SPACE_MEMOIZED_H
+#define MMPL_STATE_SPACE_MEMOIZED_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// MMPL
+#include <mmpl/edge_cache.h>
+#include <mmpl/metric.h>
+#include <mmpl/state.h>
+#include <mmpl/state_space.h>
+#include <mmpl/support.h>
+
+namespace mmpl::state_space
+{
+
+template <typename CandidateStateSpaceT, typename EdgeCheckerT, typename ValueT> class Memoized;
+
+template <typename UnderlyingMetricT> class MemoizedMetric;
+
+}  // namespace mmpl::state_space
+
+namespace mmpl
+{
+
+template <typename CandidateStateSpaceT, typename EdgeCheckerT, typename ValueT>
+struct StateSpaceTraits<state_space::Memoized<CandidateStateSpaceT, EdgeCheckerT, ValueT>>
+{
+  using StateType = state_space_state_t<CandidateStateSpaceT>;
+};
+
+
+template <typename UnderlyingMetricT> struct MetricTraits<state_space::MemoizedMetric<UnderlyingMetricT>>
+{
+  using StateType = metric_state_t<UnderlyingMetricT>;
+  using ValueType = metric_value_t<UnderlyingMetricT>;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::state_space
+{
+
+/**
+ * @brief State space which filters candidate children through an expensive edge check, memoizing its results
+ *
+ *        Candidate children are enumerated by a cheap state space (e.g. a grid without obstacles), and each candidate
+ *        edge is kept only if <code>checker(parent, child)</code> holds. Checker results are cached in an EdgeCache
+ *        keyed by the IDs of both edge states, so an edge is checked at most once per cache version, across
+ *        re-expansions of a parent and across searches sharing the cache.
+ *
+ *        The checker is the part being memoized: it must be a pure function of the edge for the current cache
+ *        version. Call <code>EdgeCache::invalidate</code> whenever the environment it checks against changes; checks
+ *        which were already running at that point are not cached.
+ *
+ * @note State IDs must be convertible to <code>std::uint64_t</code>
+ *
+ * @warn Referenced candidate state space and edge cache must outlive this object
+ */
+template <typename CandidateStateSpaceT, typename EdgeCheckerT, typename ValueT>
+class Memoized : public StateSpaceBase<Memoized<CandidateStateSpaceT, EdgeCheckerT, ValueT>>
+{
+public:
+  using StateType = state_space_state_t<CandidateStateSpaceT>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param candidates  state space enumerating candidate children
+   * @param checker  callable invoked as <code>bool(const StateType& parent, const StateType& child)</code>
+   * @param cache  cache of edge check results; may be shared with a MemoizedMetric over the same edges
+   */
+  Memoized(StateSpaceBase<CandidateStateSpaceT>& candidates, EdgeCheckerT checker, EdgeCache<ValueT>& cache) :
+      candidates_{std::addressof(candidates)},
+      checker_{std::move(checker)},
+      cache_{std::addressof(cache)}
+  {}
+
+  /**
+   * @brief Returns edge cache
+   */
+  inline EdgeCache<ValueT>& cache() { return *cache_; }
+
+  /**
+   * @brief Returns edge checker
+   */
+  inline const EdgeCheckerT& checker() const { return checker_; }
+
+private:
+  static_assert(
+    std::is_convertible<state_id_t<StateType>, std::uint64_t>(),
+    MMPL_STATIC_ASSERT_MSG("State ID must be convertible to std::uint64_t to be used as an edge cache key"));
+
+  /**
+   * @brief Checks edge from <code>parent</code> to <code>child</code>, consulting the cache first
+   */
+  inline bool is_valid(const StateType& parent, const StateType& child)
+  {
+    const std::uint64_t parent_id = parent.id();
+    const std::uint64_t child_id = child.id();
+
+    bool valid;
+    if (!cache_->try_get_validity(parent_id, child_id, valid))
+    {
+      const std::uint32_t version = cache_->version();
+      valid = checker_(parent, child);
+      cache_->set_validity(parent_id, child_id, valid, version);
+    }
+    return valid;
+  }
+
+  /**
+   * @copydoc StateSpaceBase::for_each_child
+   */
+  template <typename UnaryChildFn> inline bool for_each_child_impl(const StateType& parent, UnaryChildFn&& child_fn)
+  {
+    return candidates_->for_each_child(parent, [this, &parent, &child_fn](const StateType& child) {
+      if (is_valid(parent, child))
+      {
+        child_fn(child);
+      }
+    });
+  }
+
+  /// State space enumerating candidate children
+  StateSpaceBase<CandidateStateSpaceT>* candidates_;
+
+  /// Expensive edge check being memoized
+  EdgeCheckerT checker_;
+
+  /// Cache of edge check results
+  EdgeCache<ValueT>* cache_;
+
+  friend class StateSpaceBase<Memoized<CandidateStateSpaceT, EdgeCheckerT, ValueT>>;
+};
+
+
+/**
+ * @brief Metric which memoizes values of an expensive underlying metric
+ *
+ *        Values are cached in an EdgeCache keyed by the IDs of both edge states. The same cache may back a Memoized
+ *        state space over the same edges, in which case validity and value of an edge share a single cache entry.
+ *
+ * @note State IDs must be convertible to <code>std::uint64_t</code>
+ *
+ * @warn Referenced underlying metric and edge cache must outlive this object
+ */
+template <typename UnderlyingMetricT> class MemoizedMetric : public MetricBase<MemoizedMetric<UnderlyingMetricT>>
+{
+public:
+  using ValueType = metric_value_t<UnderlyingMetricT>;
+  using StateType = metric_state_t<UnderlyingMetricT>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param underlying  metric being memoized
+   * @param cache  cache of edge values
+   */
+  MemoizedMetric(MetricBase<UnderlyingMetricT>& underlying, EdgeCache<ValueType>& cache) :
+      underlying_{std::addressof(underlying)},
+      cache_{std::addressof(cache)}
+  {}
+
+  /**
+   * @brief Returns edge cache
+   */
+  inline EdgeCache<ValueType>& cache() { return *cache_; }
+
+private:
+  static_assert(
+    std::is_convertible<state_id_t<StateType>, std::uint64_t>(),
+    MMPL_STATIC_ASSERT_MSG("State ID must be convertible to std::uint64_t to be used as an edge cache key"));
+
+  /**
+   * @copydoc MetricBase::get_value
+   */
+  inline ValueType get_value_impl(const StateType& parent, const StateType& child)
+  {
+    const std::uint64_t parent_id = parent.id();
+    const std::uint64_t child_id = child.id();
+
+    ValueType value;
+    if (!cache_->try_get_value(parent_id, child_id, value))
+    {
+      const std::uint32_t version = cache_->version();
+      value = (*underlying_)(parent, child);
+      cache_->set_value(parent_id, child_id, value, version);
+    }
+    return value;
+  }
+
+  /// Metric being memoized
+  MetricBase<UnderlyingMetricT>* underlying_;
+
+  /// Cache of edge values
+  EdgeCache<ValueType>* cache_;
+
+  friend class MetricBase<MemoizedMetric<UnderlyingMetricT>>;
+};
+
+}  // namespace mmpl::state_space
+
+#endif  // MMPL_STATE_SPACE_MEMOIZED_H
@@ -0,0 +1,759 @@
+#ifndef MMPL_STATE_SPACE_SPACE_TIME_H
+#define MMPL_STATE_SPACE_SPACE_TIME_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// MMPL
+#include <mmpl/expansion_table.h>
+#include <mmpl/metric.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner_code.h>
+#include <mmpl/state.h>
+#include <mmpl/state_space.h>
+#include <mmpl/support.h>
+#include <mmpl/termination_criteria.h>
+
+namespace mmpl::state_space
+{
+
+template <typename StateT> class SpaceTimeState;
+
+template <typename UnderlyingStateSpaceT> class SpaceTime;
+
+template <typename UnderlyingMetricT> class SpaceTimeMetric;
+
+template <typename StateT> class SpaceTimeGoalTerminationCriteria;
+
+}  // namespace mmpl::state_space
+
+namespace mmpl
+{
+
+template <typename StateT> struct StateTraits<state_space::SpaceTimeState<StateT>>
+{
+  using IDType = std::size_t;
+};
+
+
+template <typename UnderlyingStateSpaceT> struct StateSpaceTraits<state_space::SpaceTime<UnderlyingStateSpaceT>>
+{
+  using StateType = state_space::SpaceTimeState<state_space_state_t<UnderlyingStateSpaceT>>;
+};
+
+
+template <typename UnderlyingMetricT> struct MetricTraits<state_space::SpaceTimeMetric<UnderlyingMetricT>>
+{
+  using StateType = state_space::SpaceTimeState<metric_state_t<UnderlyingMetricT>>;
+  using ValueType = metric_value_t<UnderlyingMetricT>;
+};
+
+
+template <typename StateT> struct TerminationCriteriaTraits<state_space::SpaceTimeGoalTerminationCriteria<StateT>>
+{
+  using StateType = state_space::SpaceTimeState<StateT>;
+  static constexpr bool is_expansion_aware = false;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::state_space
+{
+
+/**
+ * @brief Combines a state ID and a time step into a single hash value
+ */
+inline std::size_t space_time_hash(const std::uint64_t id, const std::uint32_t time)
+{
+  return static_cast<std::size_t>((id * 0x9E3779B97F4A7C15ULL) ^ time);
+}
+
+
+/**
+ * @brief State paired with the discrete time step at which it is occupied
+ *
+ *        Two space-time states are equal when both their underlying states and their time steps are equal
+ */
+template <typename StateT> class SpaceTimeState : public StateBase<SpaceTimeState<StateT>>
+{
+public:
+  using UnderlyingStateType = StateT;
+
+  SpaceTimeState() = default;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param _state  underlying state
+   * @param _time  time step
+   */
+  constexpr SpaceTimeState(const StateT& _state, const std::uint32_t _time) : state_{_state}, time_{_time} {}
+
+  /**
+   * @brief Returns underlying state
+   */
+  constexpr const StateT& state() const { return state_; }
+
+  /**
+   * @brief Returns time step
+   */
+  constexpr std::uint32_t time() const { return time_; }
+
+private:
+  /// Underlying state
+  StateT state_;
+
+  /// Time step
+  std::uint32_t time_;
+
+  /**
+   * @copydoc StateBase::id
+   */
+  inline std::size_t id_impl() const { return space_time_hash(state_.id(), time_); }
+
+  /**
+   * @copydoc StateBase::operator==
+   */
+  inline bool equals_impl(const SpaceTimeState& other) const
+  {
+    return this->time_ == other.time_ and this->state_ == other.state_;
+  }
+
+  friend inline std::ostream& operator<<(std::ostream& os, const SpaceTimeState& state)
+  {
+    return os << state.state_ << '@' << state.time_;
+  }
+
+  friend class StateBase<SpaceTimeState<StateT>>;
+};
+
+
+/**
+ * @brief Hashed table of vertex and edge reservations made by agents moving through a shared state space
+ *
+ *        A vertex reservation claims a state at a single time step. An edge reservation claims the move between two
+ *        states from time step <code>t</code> to <code>t + 1</code>, which forbids other agents from swapping
+ *        through the same edge in the opposite direction. A parking reservation claims a state from a time step
+ *        onward, e.g. for an agent which stays at its goal.
+ *
+ *        Each agent's reservations are also recorded in a per-agent list, so <code>release</code> removes them
+ *        in time linear in the number of reservations the agent made, without scanning the table.
+ *
+ *        Reserved states are identified by their state ID.
+ */
+class ReservationTable
+{
+public:
+  /// Agent identifier; agents are identified by small dense indices (e.g. their priority order)
+  using AgentID = std::uint32_t;
+
+  /// Agent identifier returned for unreserved states
+  static constexpr AgentID NO_AGENT = std::numeric_limits<AgentID>::max();
+
+  /**
+   * @brief Reserves <code>state</code> at <code>time</code> for <code>agent</code>
+   */
+  template <typename StateT> inline void reserve(const AgentID agent, const StateT& state, const std::uint32_t time)
+  {
+    const VertexKey key{static_cast<std::uint64_t>(state.id()), time};
+    if (vertices_.emplace(key, agent).second)
+    {
+      agent_reservations(agent).vertices.push_back(key);
+    }
+  }
+
+  /**
+   * @brief Reserves the move from <code>from</code> at <code>time</code> to <code>to</code> at <code>time + 1</code>
+   *        for <code>agent</code>
+   */
+  template <typename StateT>
+  inline void reserve(const AgentID agent, const StateT& from, const StateT& to, const std::uint32_t time)
+  {
+    const EdgeKey key{static_cast<std::uint64_t>(from.id()), static_cast<std::uint64_t>(to.id()), time};
+    if (edges_.emplace(key, agent).second)
+    {
+      agent_reservations(agent).edges.push_back(key);
+    }
+  }
+
+  /**
+   * @brief Reserves <code>state</code> for <code>agent</code> at all time steps from <code>time</code> onward
+   *
+   * @return false if another agent is already parked on <code>state</code>, in which case nothing is reserved
+   */
+  template <typename StateT> inline bool park(const AgentID agent, const StateT& state, const std::uint32_t time)
+  {
+    const auto id = static_cast<std::uint64_t>(state.id());
+    const auto [itr, inserted] = parked_.emplace(id, Parking{time, agent});
+    if (inserted)
+    {
+      agent_reservations(agent).parked.push_back(id);
+    }
+    return itr->second.agent == agent;
+  }
+
+  /**
+   * @brief Reserves all states and moves along a path of SpaceTimeState objects for <code>agent</code>
+   *
+   *        Consecutive path states must be one time step apart. The final state is parked, so the agent keeps
+   *        occupying it after reaching the end of its path.
+   *
+   * @param agent  agent making reservations
+   * @param first  iterator to first path state; must be a multi-pass (forward) iterator
+   * @param last  iterator one past last path state
+   *
+   * @return false if another agent is already parked on the final state; see <code>park</code>
+   */
+  template <typename StateIteratorT> bool reserve_path(const AgentID agent, StateIteratorT first, StateIteratorT last)
+  {
+    if (first == last)
+    {
+      return true;
+    }
+
+    auto prev = first;
+    for (++first; first != last; prev = first++)
+    {
+      MMPL_RUNTIME_ASSERT(first->time() == prev->time() + 1);
+      reserve(agent, prev->state(), prev->time());
+      reserve(agent, prev->state(), first->state(), prev->time());
+    }
+    return park(agent, prev->state(), prev->time());
+  }
+
+  /**
+   * @brief Checks if <code>agent</code> holds any reservation
+   */
+  inline bool has_reservations(const AgentID agent) const
+  {
+    if (agent >= agents_.size())
+    {
+      return false;
+    }
+    const AgentReservations& reservations = agents_[agent];
+    return !reservations.vertices.empty() or !reservations.edges.empty() or !reservations.parked.empty();
+  }
+
+  /**
+   * @brief Removes all reservations made by <code>agent</code>
+   */
+  inline void release(const AgentID agent)
+  {
+    if (agent >= agents_.size())
+    {
+      return;
+    }
+
+    AgentReservations& reservations = agents_[agent];
+    for (const VertexKey& key : reservations.vertices)
+    {
+      vertices_.erase(key);
+    }
+    for (const EdgeKey& key : reservations.edges)
+    {
+      edges_.erase(key);
+    }
+    for (const std::uint64_t id : reservations.parked)
+    {
+      parked_.erase(id);
+    }
+    reservations.vertices.clear();
+    reservations.edges.clear();
+    reservations.parked.clear();
+  }
+
+  /**
+   * @brief Removes all reservations
+   */
+  inline void clear()
+  {
+    vertices_.clear();
+    edges_.clear();
+    parked_.clear();
+    agents_.clear();
+  }
+
+  /**
+   * @brief Returns agent which occupies <code>state</code> at <code>time</code>; NO_AGENT if unreserved
+   */
+  template <typename StateT> inline AgentID owner(const StateT& state, const std::uint32_t time) const
+  {
+    const auto id = static_cast<std::uint64_t>(state.id());
+    if (const auto vertex_itr = vertices_.find(VertexKey{id, time}); vertex_itr != vertices_.end())
+    {
+      return vertex_itr->second;
+    }
+    else if (const auto parked_itr = parked_.find(id); parked_itr != parked_.end() and parked_itr->second.time <= time)
+    {
+      return parked_itr->second.agent;
+    }
+    return NO_AGENT;
+  }
+
+  /**
+   * @brief Checks if moving from <code>from</code> at <code>time</code> to <code>to</code> at <code>time + 1</code>
+   *        conflicts with no reservation
+   *
+   *        A move conflicts when <code>to</code> is occupied at <code>time + 1</code>, or when another agent moves
+   *        from <code>to</code> to <code>from</code> over the same time step. Waiting is a move with
+   *        <code>from == to</code>.
+   */
+  template <typename StateT> inline bool is_free(const StateT& from, const StateT& to, const std::uint32_t time) const
+  {
+    if (owner(to, time + 1) != NO_AGENT)
+    {
+      return false;
+    }
+    else if (edges_.empty())
+    {
+      return true;
+    }
+    const EdgeKey swap{static_cast<std::uint64_t>(to.id()), static_cast<std::uint64_t>(from.id()), time};
+    return edges_.find(swap) == edges_.end();
+  }
+
+  /**
+   * @brief Checks if <code>state</code> is unreserved at every time step in <code>[time, horizon]</code>
+   */
+  template <typename StateT>
+  inline bool is_free_after(const StateT& state, const std::uint32_t time, const std::uint32_t horizon) const
+  {
+    for (std::uint32_t t = time; t <= horizon; ++t)
+    {
+      if (owner(state, t) != NO_AGENT)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Returns total number of vertex, edge and parking reservations
+   */
+  inline std::size_t size() const { return vertices_.size() + edges_.size() + parked_.size(); }
+
+private:
+  /**
+   * @brief Vertex reservation key
+   */
+  struct VertexKey
+  {
+    std::uint64_t id;
+    std::uint32_t time;
+
+    inline bool operator==(const VertexKey& other) const { return id == other.id and time == other.time; }
+  };
+
+  /**
+   * @brief Edge reservation key
+   */
+  struct EdgeKey
+  {
+    std::uint64_t from;
+    std::uint64_t to;
+    std::uint32_t time;
+
+    inline bool operator==(const EdgeKey& other) const
+    {
+      return from == other.from and to == other.to and time == other.time;
+    }
+  };
+
+  /**
+   * @brief Parking reservation
+   */
+  struct Parking
+  {
+    std::uint32_t time;
+    AgentID agent;
+  };
+
+  struct KeyHash
+  {
+    inline std::size_t operator()(const VertexKey& key) const { return space_time_hash(key.id, key.time); }
+
+    inline std::size_t operator()(const EdgeKey& key) const
+    {
+      return space_time_hash(key.from ^ (key.to * 0xC2B2AE3D27D4EB4FULL), key.time);
+    }
+  };
+
+  /**
+   * @brief Reservations made by a single agent
+   */
+  struct AgentReservations
+  {
+    std::vector<VertexKey> vertices;
+    std::vector<EdgeKey> edges;
+    std::vector<std::uint64_t> parked;
+  };
+
+  /**
+   * @brief Returns reservation list of <code>agent</code>, growing the per-agent lists as needed
+   */
+  inline AgentReservations& agent_reservations(const AgentID agent)
+  {
+    MMPL_RUNTIME_ASSERT(agent != NO_AGENT);
+    if (agent >= agents_.size())
+    {
+      agents_.resize(agent + 1);
+    }
+    return agents_[agent];
+  }
+
+  /// [vertex, agent] reservations
+  std::unordered_map<VertexKey, AgentID, KeyHash> vertices_;
+
+  /// [edge, agent] reservations
+  std::unordered_map<EdgeKey, AgentID, KeyHash> edges_;
+
+  /// [state ID, parking] reservations
+  std::unordered_map<std::uint64_t, Parking> parked_;
+
+  /// Per-agent reservation lists, indexed by agent ID
+  std::vector<AgentReservations> agents_;
+};
+
+
+/**
+ * @brief Lifts a state space to (state, time) pairs for planning around reservations of other agents
+ *
+ *        Children of <code>(s, t)</code> are <code>(c, t + 1)</code> for each child <code>c</code> of <code>s</code>
+ *        in the underlying state space, along with the wait action <code>(s, t + 1)</code>; moves which conflict with
+ *        a reservation are skipped. States at <code>max_time</code> have no children, which bounds the search when the
+ *        goal is unreachable.
+ *
+ * @warn Referenced underlying state space and reservation table must outlive this object
+ */
+template <typename UnderlyingStateSpaceT>
+class SpaceTime : public StateSpaceBase<SpaceTime<UnderlyingStateSpaceT>>
+{
+public:
+  using UnderlyingStateType = state_space_state_t<UnderlyingStateSpaceT>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param underlying  state space being lifted
+   * @param reservations  reservations of other agents; changes are visible to this state space
+   * @param max_time  last time step which may be reached
+   */
+  SpaceTime(
+    StateSpaceBase<UnderlyingStateSpaceT>& underlying,
+    const ReservationTable& reservations,
+    const std::uint32_t max_time) :
+      underlying_{std::addressof(underlying)},
+      reservations_{std::addressof(reservations)},
+      max_time_{max_time}
+  {}
+
+  /**
+   * @brief Returns reservations of other agents
+   */
+  inline const ReservationTable& reservations() const { return *reservations_; }
+
+  /**
+   * @brief Returns last time step which may be reached
+   */
+  inline std::uint32_t max_time() const { return max_time_; }
+
+private:
+  /**
+   * @copydoc StateSpaceBase::for_each_child
+   */
+  template <typename UnaryChildFn>
+  inline bool for_each_child_impl(const SpaceTimeState<UnderlyingStateType>& parent, UnaryChildFn&& child_fn)
+  {
+    const std::uint32_t time = parent.time();
+    if (time >= max_time_)
+    {
+      return true;
+    }
+
+    if (reservations_->is_free(parent.state(), parent.state(), time))
+    {
+      child_fn(SpaceTimeState<UnderlyingStateType>{parent.state(), time + 1});
+    }
+
+    const auto lift_free = [this, &parent, time, &child_fn](const UnderlyingStateType& child) {
+      if (reservations_->is_free(parent.state(), child, time))
+      {
+        child_fn(SpaceTimeState<UnderlyingStateType>{child, time + 1});
+      }
+    };
+    return underlying_->for_each_child(parent.state(), lift_free);
+  }
+
+  /// State space being lifted
+  StateSpaceBase<UnderlyingStateSpaceT>* underlying_;
+
+  /// Reservations of other agents
+  const ReservationTable* reservations_;
+
+  /// Last time step which may be reached
+  std::uint32_t max_time_;
+
+  friend class StateSpaceBase<SpaceTime<UnderlyingStateSpaceT>>;
+};
+
+
+/**
+ * @brief Lifts a metric to (state, time) pairs
+ *
+ *        Moves are valued by the underlying metric; waiting in place for one time step is valued by a fixed wait
+ *        value, which should be positive so that searches prefer arriving early
+ *
+ * @warn Referenced underlying metric must outlive this object
+ */
+template <typename UnderlyingMetricT> class SpaceTimeMetric : public MetricBase<SpaceTimeMetric<UnderlyingMetricT>>
+{
+public:
+  using ValueType = metric_value_t<UnderlyingMetricT>;
+  using UnderlyingStateType = metric_state_t<UnderlyingMetricT>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param underlying  metric valuing moves between distinct states
+   * @param wait_value  value of waiting in place for one time step
+   */
+  SpaceTimeMetric(MetricBase<UnderlyingMetricT>& underlying, const ValueType& wait_value) :
+      underlying_{std::addressof(underlying)},
+      wait_value_{wait_value}
+  {}
+
+private:
+  /**
+   * @copydoc MetricBase::get_value
+   */
+  inline ValueType get_value_impl(
+    const SpaceTimeState<UnderlyingStateType>& parent,
+    const SpaceTimeState<UnderlyingStateType>& child)
+  {
+    return (parent.state() == child.state()) ? wait_value_ : (*underlying_)(parent.state(), child.state());
+  }
+
+  /// Metric valuing moves between distinct states
+  MetricBase<UnderlyingMetricT>* underlying_;
+
+  /// Value of waiting in place for one time step
+  ValueType wait_value_;
+
+  friend class MetricBase<SpaceTimeMetric<UnderlyingMetricT>>;
+};
+
+
+/**
+ * @brief Terminates search at a goal state which no reservation claims at the arrival time or later
+ *
+ *        Arrivals at the goal which would later be run over by another agent are rejected, so the agent may stay
+ *        parked at its goal once there. The arrival time of the last accepted goal state is recorded.
+ *
+ * @warn Referenced reservation table must outlive this object
+ */
+template <typename StateT>
+class SpaceTimeGoalTerminationCriteria : public TerminationCriteriaBase<SpaceTimeGoalTerminationCriteria<StateT>>
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param goal  goal state
+   * @param reservations  reservations of other agents
+   * @param max_time  last time step checked for reservations
+   */
+  SpaceTimeGoalTerminationCriteria(const StateT& goal, const ReservationTable& reservations, std::uint32_t max_time) :
+      goal_{goal},
+      reservations_{std::addressof(reservations)},
+      max_time_{max_time}
+  {}
+
+  /**
+   * @brief Returns last goal state accepted as terminal
+   */
+  inline SpaceTimeState<StateT> terminal() const { return SpaceTimeState<StateT>{goal_, arrival_time_}; }
+
+private:
+  inline bool is_terminal_impl(const SpaceTimeState<StateT>& query) const
+  {
+    if (query.state() == goal_ and reservations_->is_free_after(goal_, query.time(), max_time_))
+    {
+      arrival_time_ = query.time();
+      return true;
+    }
+    return false;
+  }
+
+  /// Goal state
+  StateT goal_;
+
+  /// Reservations of other agents
+  const ReservationTable* reservations_;
+
+  /// Last time step checked for reservations
+  std::uint32_t max_time_;
+
+  /// Arrival time of last accepted goal state
+  mutable std::uint32_t arrival_time_ = 0;
+
+  friend class TerminationCriteriaBase<SpaceTimeGoalTerminationCriteria<StateT>>;
+};
+
+
+/**
+ * @brief Continues a single-agent space-time search from the current contents of the planner's expansion queue
+ *
+ *        Used to resume a search whose expansion table still holds valid records, with the states whose children
+ *        must be regenerated re-enqueued (see PlannerBase::requeue)
+ *
+ * @param planner  planner over SpaceTimeState objects
+ * @param metric  space-time metric
+ * @param state_space  space-time state space
+ * @param goal  goal state
+ * @param[out] path  receives path states, from start to goal; left empty if no path was found
+ *
+ * @return pair of (planner code, iterations); code is GOAL_FOUND, or INFEASIBLE if the goal could not be reached by
+ *         <code>state_space.max_time()</code>
+ */
+template <typename PlannerT, typename MetricT, typename UnderlyingStateSpaceT>
+std::pair<PlannerCode, std::size_t> resume_space_time(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  SpaceTime<UnderlyingStateSpaceT>& state_space,
+  const state_space_state_t<UnderlyingStateSpaceT>& goal,
+  std::vector<SpaceTimeState<state_space_state_t<UnderlyingStateSpaceT>>>& path)
+{
+  using StateType = state_space_state_t<UnderlyingStateSpaceT>;
+  using SpaceTimeStateType = SpaceTimeState<StateType>;
+
+  path.clear();
+
+  SpaceTimeGoalTerminationCriteria<StateType> criteria{goal, state_space.reservations(), state_space.max_time()};
+
+  PlannerCode code;
+  std::size_t iterations{0};
+  while (code == PlannerCode::SEARCHING)
+  {
+    ++iterations;
+    code = planner.update(metric, state_space, criteria);
+  }
+
+  if (code != PlannerCode::GOAL_FOUND)
+  {
+    return std::make_pair(PlannerCode::INFEASIBLE, iterations);
+  }
+
+  const SpaceTimeStateType terminal = criteria.terminal();
+  path.clear();
+  generate_reverse_path(std::back_inserter(path), terminal, planner.expansion_table());
+  std::reverse(path.begin(), path.end());
+  return std::make_pair(PlannerCode::GOAL_FOUND, iterations);
+}
+
+
+/**
+ * @brief Plans a single agent from <code>start</code> at time zero to <code>goal</code>, around all reservations read
+ *        by <code>state_space</code>
+ *
+ *        The planner is reset beforehand, so a single planner may be reused across agents and queries without
+ *        reallocating its queue and table.
+ *
+ * @param planner  planner over SpaceTimeState objects
+ * @param metric  space-time metric
+ * @param state_space  space-time state space
+ * @param start  start state
+ * @param goal  goal state
+ * @param[out] path  receives path states, from start to goal; left empty if no path was found
+ *
+ * @return GOAL_FOUND, or INFEASIBLE if the goal could not be reached by <code>state_space.max_time()</code>
+ */
+template <typename PlannerT, typename MetricT, typename UnderlyingStateSpaceT>
+PlannerCode plan_space_time(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  SpaceTime<UnderlyingStateSpaceT>& state_space,
+  const state_space_state_t<UnderlyingStateSpaceT>& start,
+  const state_space_state_t<UnderlyingStateSpaceT>& goal,
+  std::vector<SpaceTimeState<state_space_state_t<UnderlyingStateSpaceT>>>& path)
+{
+  planner.reset();
+  planner.enqueue(SpaceTimeState<state_space_state_t<UnderlyingStateSpaceT>>{start, 0});
+  return resume_space_time(planner, metric, state_space, goal, path).first;
+}
+
+
+/**
+ * @brief Plans agents one after another in priority order, each around the reservations of all agents before it
+ *
+ *        Every path found is reserved for its agent before the next agent is planned, so that all agents are planned
+ *        in a single pass; the first agent takes priority over all others. Agent IDs are assigned in priority order,
+ *        starting from <code>first_agent</code>. Reservations already held in the table (e.g. of agents moving
+ *        outside of mmpl) are respected as well, and must be held under IDs outside of those assigned here.
+ *
+ * @param planner  planner over SpaceTimeState objects; reset before each agent is planned
+ * @param metric  space-time metric
+ * @param state_space  space-time state space which reads <code>reservations</code>
+ * @param reservations  reservation table receiving agent paths
+ * @param starts_first  iterator to start state of first (highest priority) agent
+ * @param starts_last  iterator one past start state of last agent
+ * @param goals_first  iterator to goal state of first agent
+ * @param paths  output iterator receiving one <code>std::vector</code> of SpaceTimeState objects per planned agent
+ * @param first_agent  reservation ID of the first agent
+ *
+ * @return pair of (planner code, number of agents planned); code is INFEASIBLE if an agent could not reach its goal
+ *         by <code>state_space.max_time()</code>, in which case no further agents are planned
+ */
+template <
+  typename PlannerT,
+  typename MetricT,
+  typename UnderlyingStateSpaceT,
+  typename StateIteratorT,
+  typename PathOutputIteratorT>
+std::pair<PlannerCode, std::size_t> plan_prioritized(
+  PlannerBase<PlannerT>& planner,
+  MetricBase<MetricT>& metric,
+  SpaceTime<UnderlyingStateSpaceT>& state_space,
+  ReservationTable& reservations,
+  StateIteratorT starts_first,
+  StateIteratorT starts_last,
+  StateIteratorT goals_first,
+  PathOutputIteratorT paths,
+  const ReservationTable::AgentID first_agent = 0)
+{
+  using SpaceTimeStateType = SpaceTimeState<state_space_state_t<UnderlyingStateSpaceT>>;
+
+  MMPL_RUNTIME_ASSERT(std::addressof(reservations) == std::addressof(state_space.reservations()));
+
+  std::size_t agent = 0;
+  for (; starts_first != starts_last; ++starts_first, ++goals_first, ++agent)
+  {
+    const auto id = static_cast<ReservationTable::AgentID>(first_agent + agent);
+    MMPL_RUNTIME_ASSERT(!reservations.has_reservations(id));
+
+    std::vector<SpaceTimeStateType> path;
+    if (plan_space_time(planner, metric, state_space, *starts_first, *goals_first, path) != PlannerCode::GOAL_FOUND)
+    {
+      return std::make_pair(PlannerCode::INFEASIBLE, agent);
+    }
+
+    // Goal arrivals are only accepted on states which stay free, so parking cannot collide
+    [[maybe_unused]] const bool parked = reservations.reserve_path(id, path.begin(), path.end());
+    MMPL_RUNTIME_ASSERT(parked);
+    *paths++ = std::move(path);
+  }
+  return std::make_pair(PlannerCode::GOAL_FOUND, agent);
+}
+
+}  // namespace mmpl::state_space
+
+#endif  // MMPL_STATE_SPACE_SPACE_TIME_H
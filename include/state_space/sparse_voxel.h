@@ -0,0 +1,136 @@
+#ifndef MMPL_STATE_SPACE_SPARSE_VOXEL_H
+#define MMPL_STATE_SPACE_SPARSE_VOXEL_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// MMPL
+#include <mmpl/grid/neighborhood.h>
+#include <mmpl/grid/voxel_map.h>
+#include <mmpl/state_space.h>
+
+namespace mmpl::state_space
+{
+
+template <std::size_t Connectivity> class SparseVoxelGrid;
+
+}  // namespace mmpl::state_space
+
+namespace mmpl
+{
+
+template <std::size_t Connectivity> struct StateSpaceTraits<state_space::SparseVoxelGrid<Connectivity>>
+{
+  using StateType = grid::Voxel;
+  static constexpr std::size_t child_block_size = Connectivity;
+};
+
+}  // namespace mmpl
+
+namespace mmpl::state_space
+{
+
+/**
+ * @brief State space over the free voxels of a sparse grid::VoxelBlockMap
+ *
+ *        Children of a voxel are its free in-bounds neighbors under <code>grid::Neighborhood<3, Connectivity></code>.
+ *        Neighbor blocks are looked up at most once per expansion: the block of the parent voxel is hashed once and
+ *        serves all neighbors which fall in the same block (all of them, for voxels away from block faces), and
+ *        blocks across faces are hashed only when first needed. Neighbors in blocks which are not stored are free
+ *        without any bit test, so expansions through empty space are cheap.
+ *
+ * @warn Referenced voxel map must outlive this object, and must not be modified while a child is being enumerated
+ */
+template <std::size_t Connectivity> class SparseVoxelGrid : public StateSpaceBase<SparseVoxelGrid<Connectivity>>
+{
+public:
+  /// Neighbor offsets, in direction-code order
+  using NeighborhoodType = grid::Neighborhood<3, Connectivity>;
+
+  /**
+   * @brief Initialization constructor
+   *
+   * @param map  occupancy map; changes to the map are visible to this state space
+   */
+  explicit SparseVoxelGrid(const grid::VoxelBlockMap& map) : map_{std::addressof(map)} {}
+
+  /**
+   * @brief Returns underlying occupancy map
+   */
+  inline const grid::VoxelBlockMap& map() const { return *map_; }
+
+private:
+  /**
+   * @brief Invokes <code>voxel_fn</code> with each free in-bounds neighbor of <code>voxel</code>
+   */
+  template <typename UnaryVoxelFn> inline void for_each_free_neighbor(const grid::Voxel& voxel, UnaryVoxelFn&& voxel_fn)
+  {
+    using Block = grid::VoxelBlockMap::Block;
+
+    const grid::Coordinates<3>& coordinates = voxel.coordinates();
+    const grid::Coordinates<3> block = grid::VoxelBlockMap::block_coordinates(coordinates);
+
+    // Blocks adjacent to the parent block, indexed by block offset; filled on first use
+    std::array<const Block*, 27> neighbor_blocks;
+    std::uint32_t found = 0;
+
+    for (std::size_t code = 0; code < Connectivity; ++code)
+    {
+      const grid::Coordinates<3> neighbor{coordinates[0] + NeighborhoodType::offsets[code][0],
+                                          coordinates[1] + NeighborhoodType::offsets[code][1],
+                                          coordinates[2] + NeighborhoodType::offsets[code][2]};
+      if (!map_->in_bounds(neighbor))
+      {
+        continue;
+      }
+
+      const grid::Coordinates<3> neighbor_block = grid::VoxelBlockMap::block_coordinates(neighbor);
+      const std::int32_t slot = (neighbor_block[0] - block[0] + 1) + 3 * (neighbor_block[1] - block[1] + 1) +
+        9 * (neighbor_block[2] - block[2] + 1);
+      if (!(found & (1U << slot)))
+      {
+        neighbor_blocks[slot] = map_->find_block(neighbor_block);
+        found |= (1U << slot);
+      }
+
+      if (neighbor_blocks[slot] == nullptr or
+          !grid::VoxelBlockMap::test(*neighbor_blocks[slot], grid::VoxelBlockMap::local_index(neighbor)))
+      {
+        voxel_fn(grid::Voxel{neighbor});
+      }
+    }
+  }
+
+  /**
+   * @copydoc StateSpaceBase::for_each_child
+   */
+  template <typename UnaryChildFn> inline bool for_each_child_impl(const grid::Voxel& parent, UnaryChildFn&& child_fn)
+  {
+    for_each_free_neighbor(parent, child_fn);
+    return true;
+  }
+
+  /**
+   * @copydoc StateSpaceBase::for_each_child_block
+   */
+  template <typename UnaryBlockFn>
+  inline bool for_each_child_block_impl(const grid::Voxel& parent, UnaryBlockFn&& block_fn)
+  {
+    ChildBlock<grid::Voxel, Connectivity> block;
+    for_each_free_neighbor(parent, [&block](const grid::Voxel& child) { block.states[block.size++] = child; });
+    block_fn(block);
+    return true;
+  }
+
+  /// Occupancy map
+  const grid::VoxelBlockMap* map_;
+
+  friend class StateSpaceBase<SparseVoxelGrid<Connectivity>>;
+};
+
+}  // namespace mmpl::state_space
+
+#endif  // MMPL_STATE_SPACE_SPARSE_VOXEL_H
@@ -7,6 +7,7 @@
 
 // MMPL
 #include <mmpl/crtp.h>
+#include <mmpl/expansion_table.h>
 #include <mmpl/state.h>
 
 namespace mmpl
@@ -58,6 +59,39 @@ template <typename StateT> struct TerminationCriteriaTraits<SingleGoalTerminatio
   static constexpr bool is_expansion_aware = false;
 };
 
+
+/**
+ * @brief Terminates search once the next state to expand has a total value greater than <code>radius</code>
+ *
+ *        States are expanded in order of total value, so every state within <code>radius</code> of the search
+ *        roots has been expanded when this criteria is met
+ */
+template <typename StateT, typename ValueT>
+class CostRadiusTerminationCriteria : public TerminationCriteriaBase<CostRadiusTerminationCriteria<StateT, ValueT>>
+{
+public:
+  explicit CostRadiusTerminationCriteria(const ValueT& _radius) : radius_{_radius} {}
+
+private:
+  template <typename ExpansionTableT>
+  inline bool is_terminal_impl(const ExpansionTableBase<ExpansionTableT>& expansion_table, const StateT& query) const
+  {
+    return radius_ < expansion_table.get_total_value(query);
+  }
+
+  ValueT radius_;
+
+  friend class TerminationCriteriaBase<CostRadiusTerminationCriteria<StateT, ValueT>>;
+};
+
+
+template <typename StateT, typename ValueT>
+struct TerminationCriteriaTraits<CostRadiusTerminationCriteria<StateT, ValueT>>
+{
+  using StateType = StateT;
+  static constexpr bool is_expansion_aware = true;
+};
+
 }  // namespace mmpl
 
 #endif  // MMPL_TERMINATION_CRITERIA_H
@@ -0,0 +1,336 @@
+#ifndef MMPL_TRACE_H
+#define MMPL_TRACE_H
+
+/**
+ * @file trace.h
+ * @brief Optional scoped timing instrumentation, exported as Chrome trace JSON
+ *
+ *        Disabled unless <code>MMPL_ENABLE_TRACE</code> is defined, in which case planner phases (queue push/pop,
+ *        child generation, metric evaluation, expansion table lookups and path extraction) record their timings into
+ *        per-thread buffers. Buffers are written out with trace::write_chrome_trace, and the result may be opened
+ *        with <code>chrome://tracing</code> or Perfetto. When disabled, instrumentation macros expand to their
+ *        arguments only, and none of the recording machinery is declared.
+ *
+ * @warn <code>MMPL_ENABLE_TRACE</code> must be defined consistently across all translation units of a program
+ */
+
+#ifdef MMPL_ENABLE_TRACE
+
+// C++ Standard Library
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#ifndef MMPL_TRACE_BUFFER_CAPACITY
+/**
+ * @brief Largest number of events held per thread between calls to trace::clear; further events are dropped
+ */
+#define MMPL_TRACE_BUFFER_CAPACITY (std::size_t{1} << 20)
+#endif  // MMPL_TRACE_BUFFER_CAPACITY
+
+namespace mmpl::trace
+{
+
+/**
+ * @brief Completed timing span
+ */
+struct Event
+{
+  /// Span name; must point to a string literal which needs no JSON escaping
+  const char* name;
+
+  /// Span start, in nanoseconds since trace epoch
+  std::int64_t begin;
+
+  /// Span end, in nanoseconds since trace epoch
+  std::int64_t end;
+};
+
+
+/**
+ * @brief Events recorded by a single thread
+ */
+struct Buffer
+{
+  /// Trace thread index, used as Chrome trace thread ID
+  std::size_t thread_index;
+
+  /// Recorded events, in order of completion
+  std::vector<Event> events;
+
+  /// Number of events dropped since buffer was last cleared
+  std::size_t dropped = 0;
+
+  /// Whether a live thread currently records into this buffer
+  bool owned = true;
+};
+
+
+namespace detail
+{
+
+/// Time point which recorded event times are relative to
+inline const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+
+/**
+ * @brief Returns nanoseconds elapsed since trace epoch
+ */
+inline std::int64_t now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+
+/**
+ * @brief Owns buffers of all threads which recorded events
+ *
+ *        Buffers outlive their threads, so that events of finished threads are still exported. Buffers released by
+ *        finished threads are handed to new threads, which keeps the buffer count bounded by the peak thread count.
+ */
+class Registry
+{
+public:
+  static Registry& instance()
+  {
+    static Registry registry;
+    return registry;
+  }
+
+  /**
+   * @brief Returns a buffer for the calling thread to record into
+   */
+  inline Buffer* acquire()
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (auto& buffer : buffers_)
+    {
+      if (!buffer->owned)
+      {
+        buffer->owned = true;
+        return buffer.get();
+      }
+    }
+    buffers_.push_back(std::make_unique<Buffer>());
+    buffers_.back()->thread_index = buffers_.size() - 1;
+    buffers_.back()->events.reserve(1024);
+    return buffers_.back().get();
+  }
+
+  /**
+   * @brief Makes a buffer available to other threads, keeping its events
+   */
+  inline void release(Buffer* buffer)
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    buffer->owned = false;
+  }
+
+  /**
+   * @brief Calls <code>buffer_fn(Buffer&)</code> on every buffer
+   */
+  template <typename BufferFnT> inline void for_each(BufferFnT&& buffer_fn)
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (auto& buffer : buffers_)
+    {
+      buffer_fn(*buffer);
+    }
+  }
+
+private:
+  Registry() = default;
+
+  /// Protects buffer list and buffer ownership
+  std::mutex mutex_;
+
+  /// All buffers; stable addresses
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+
+/**
+ * @brief Holds buffer of the calling thread, and releases it when the thread exits
+ */
+class LocalBuffer
+{
+public:
+  LocalBuffer() : buffer_{Registry::instance().acquire()} {}
+
+  ~LocalBuffer() { Registry::instance().release(buffer_); }
+
+  LocalBuffer(const LocalBuffer&) = delete;
+
+  LocalBuffer& operator=(const LocalBuffer&) = delete;
+
+  inline Buffer& get() { return *buffer_; }
+
+private:
+  /// Registry-owned buffer
+  Buffer* buffer_;
+};
+
+
+/**
+ * @brief Returns buffer of the calling thread
+ */
+inline Buffer& local_buffer()
+{
+  thread_local LocalBuffer buffer;
+  return buffer.get();
+}
+
+}  // namespace detail
+
+
+/**
+ * @brief Records the span between its construction and destruction into the calling thread's buffer
+ */
+class Scope
+{
+public:
+  /**
+   * @brief Starts span
+   *
+   * @param name  span name; must point to a string literal which needs no JSON escaping
+   */
+  explicit Scope(const char* name) : name_{name}, begin_{detail::now()} {}
+
+  ~Scope()
+  {
+    const std::int64_t end = detail::now();
+    auto& buffer = detail::local_buffer();
+    if (buffer.events.size() < MMPL_TRACE_BUFFER_CAPACITY)
+    {
+      buffer.events.push_back(Event{name_, begin_, end});
+    }
+    else
+    {
+      ++buffer.dropped;
+    }
+  }
+
+  Scope(const Scope&) = delete;
+
+  Scope& operator=(const Scope&) = delete;
+
+private:
+  /// Span name
+  const char* name_;
+
+  /// Span start, in nanoseconds since trace epoch
+  std::int64_t begin_;
+};
+
+
+/**
+ * @brief Returns result of <code>fn()</code>, recording the time it took as a span named <code>name</code>
+ */
+template <typename FnT> inline decltype(auto) timed(const char* name, FnT&& fn)
+{
+  const Scope scope{name};
+  return fn();
+}
+
+
+/**
+ * @brief Returns number of recorded events over all threads
+ */
+inline std::size_t event_count()
+{
+  std::size_t count = 0;
+  detail::Registry::instance().for_each([&count](const Buffer& buffer) { count += buffer.events.size(); });
+  return count;
+}
+
+
+/**
+ * @brief Returns number of events dropped over all threads because buffers were full
+ */
+inline std::size_t dropped_count()
+{
+  std::size_t count = 0;
+  detail::Registry::instance().for_each([&count](const Buffer& buffer) { count += buffer.dropped; });
+  return count;
+}
+
+
+/**
+ * @brief Discards events recorded by all threads
+ *
+ * @warn Must not be called while other threads may be recording events
+ */
+inline void clear()
+{
+  detail::Registry::instance().for_each([](Buffer& buffer) {
+    buffer.events.clear();
+    buffer.dropped = 0;
+  });
+}
+
+
+/**
+ * @brief Writes events recorded by all threads as Chrome trace JSON
+ *
+ *        Each event is written as a complete ("X") event with microsecond timestamps; the trace thread index of the
+ *        recording thread is used as its thread ID
+ *
+ * @param os  output stream
+ *
+ * @warn Must not be called while other threads may be recording events
+ */
+inline void write_chrome_trace(std::ostream& os)
+{
+  os << "{\"traceEvents\":[";
+
+  bool first = true;
+  char line[256];
+  detail::Registry::instance().for_each([&](const Buffer& buffer) {
+    for (const auto& event : buffer.events)
+    {
+      std::snprintf(
+        line,
+        sizeof(line),
+        "%s\n{\"name\":\"%s\",\"cat\":\"mmpl\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%zu}",
+        first ? "" : ",",
+        event.name,
+        static_cast<double>(event.begin) * 1e-3,
+        static_cast<double>(event.end - event.begin) * 1e-3,
+        buffer.thread_index);
+      os << line;
+      first = false;
+    }
+  });
+
+  os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+}  // namespace mmpl::trace
+
+#define MMPL_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define MMPL_TRACE_CONCAT(lhs, rhs) MMPL_TRACE_CONCAT_IMPL(lhs, rhs)
+
+/**
+ * @brief Records a span named <code>name</code> from this point to the end of the enclosing scope
+ */
+#define MMPL_TRACE_SCOPE(name) const ::mmpl::trace::Scope MMPL_TRACE_CONCAT(mmpl_trace_scope_, __LINE__){name}
+
+/**
+ * @brief Evaluates an expression, recording the time it took as a span named <code>name</code>
+ */
+#define MMPL_TRACE_EXPR(name, ...) ::mmpl::trace::timed(name, [&]() -> decltype(auto) { return __VA_ARGS__; })
+
+#else  // MMPL_ENABLE_TRACE
+
+#define MMPL_TRACE_SCOPE(name)
+
+#define MMPL_TRACE_EXPR(name, ...) (__VA_ARGS__)
+
+#endif  // MMPL_ENABLE_TRACE
+
+#endif  // MMPL_TRACE_H
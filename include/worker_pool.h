@@ -0,0 +1,152 @@
+#ifndef MMPL_WORKER_POOL_H
+#define MMPL_WORKER_POOL_H
+
+// C++ Standard Library
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// MMPL
+#include <mmpl/support.h>
+
+namespace mmpl
+{
+
+/**
+ * @brief Fixed set of threads which repeatedly run a common job
+ *
+ *        Meant for planners which alternate between short parallel phases and serial bookkeeping; workers are
+ *        created once and parked between phases instead of being spawned per phase.
+ */
+class WorkerPool
+{
+public:
+  /**
+   * @brief Initialization constructor
+   *
+   * @param worker_count  total number of workers, including the thread which calls <code>run</code>
+   */
+  explicit WorkerPool(const std::size_t worker_count) : worker_count_{worker_count > 0 ? worker_count : 1}
+  {
+    threads_.reserve(worker_count_ - 1);
+    for (std::size_t index = 1; index < worker_count_; ++index)
+    {
+      threads_.emplace_back([this, index] { work(index); });
+    }
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  ~WorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      stopping_ = true;
+    }
+    job_available_.notify_all();
+    for (auto& thread : threads_)
+    {
+      thread.join();
+    }
+  }
+
+  /**
+   * @brief Returns total number of workers
+   */
+  inline std::size_t size() const { return worker_count_; }
+
+  /**
+   * @brief Runs <code>job(worker_index)</code> on every worker and waits for all to finish
+   *
+   *        The calling thread runs the job as worker 0.
+   */
+  template <typename JobFn> inline void run(JobFn&& job)
+  {
+    if (threads_.empty())
+    {
+      job(std::size_t{0});
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      job_ = std::ref(job);
+      remaining_ = threads_.size();
+      ++generation_;
+    }
+    job_available_.notify_all();
+
+    job(std::size_t{0});
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    job_finished_.wait(lock, [this] { return remaining_ == 0; });
+    job_ = nullptr;
+  }
+
+private:
+  /**
+   * @brief Worker thread loop
+   */
+  inline void work(const std::size_t index)
+  {
+    std::size_t generation = 0;
+    while (true)
+    {
+      std::function<void(std::size_t)> job;
+      {
+        std::unique_lock<std::mutex> lock{mutex_};
+        job_available_.wait(lock, [this, generation] { return stopping_ or generation_ != generation; });
+        if (stopping_)
+        {
+          return;
+        }
+        generation = generation_;
+        job = job_;
+      }
+
+      job(index);
+
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+        --remaining_;
+      }
+      job_finished_.notify_one();
+    }
+  }
+
+  /// Total number of workers
+  std::size_t worker_count_;
+
+  /// Worker threads (excluding calling thread)
+  std::vector<std::thread> threads_;
+
+  /// Guards job state
+  std::mutex mutex_;
+
+  /// Signals workers that a new job is available
+  std::condition_variable job_available_;
+
+  /// Signals caller that a worker finished its job
+  std::condition_variable job_finished_;
+
+  /// Active job
+  std::function<void(std::size_t)> job_;
+
+  /// Job counter used to wake workers exactly once per job
+  std::size_t generation_ = 0;
+
+  /// Number of workers still running active job
+  std::size_t remaining_ = 0;
+
+  /// Set to stop worker threads
+  bool stopping_ = false;
+};
+
+}  // namespace mmpl
+
+#endif  // MMPL_WORKER_POOL_H
@@ -0,0 +1,300 @@
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/cost_to_go.h>
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/grid/layout.h>
+#include <mmpl/grid/neighborhood.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/planner.h>
+#include <mmpl/range_query.h>
+
+using namespace mmpl;
+
+namespace mmpl
+{
+
+class TestOctileMetric;
+class TestOccupancyStateSpace;
+
+template <> struct MetricTraits<TestOctileMetric>
+{
+  using StateType = grid::Cell<2>;
+  using ValueType = int;
+};
+
+
+template <> struct StateSpaceTraits<TestOccupancyStateSpace>
+{
+  using StateType = grid::Cell<2>;
+};
+
+
+class TestOctileMetric : public MetricBase<TestOctileMetric>
+{
+private:
+  inline int get_value_impl(const grid::Cell<2>& parent, const grid::Cell<2>& child) const
+  {
+    return (parent[0] == child[0] or parent[1] == child[1]) ? 10 : 14;
+  }
+
+  friend class MetricBase<TestOctileMetric>;
+};
+
+
+class TestOccupancyStateSpace : public StateSpaceBase<TestOccupancyStateSpace>
+{
+public:
+  explicit TestOccupancyStateSpace(const grid::Occupancy<2>& occupancy) : occupancy_{std::addressof(occupancy)} {}
+
+private:
+  template <typename UnaryChildFn> inline bool for_each_child_impl(const grid::Cell<2>& parent, UnaryChildFn&& child_fn)
+  {
+    const std::uint8_t mask = occupancy_->free_neighbors(parent);
+    for (std::uint8_t code = 0; code < 8; ++code)
+    {
+      if (mask & (1 << code))
+      {
+        child_fn(occupancy_->layout().neighbor(parent, grid::Neighborhood<2, 8>::offsets[code]));
+      }
+    }
+    return true;
+  }
+
+  const grid::Occupancy<2>* occupancy_;
+
+  friend class StateSpaceBase<TestOccupancyStateSpace>;
+};
+
+}  // namespace mmpl
+
+
+using TestField = CostToGoField<grid::Cell<2>, int, grid::Layout<2>>;
+
+using TestPlanner = ShortestPathPlanner<grid::Cell<2>, int, expansion_queue::MinSorted<grid::Cell<2>, int>, TestField>;
+
+
+class CostToGoTest : public ::testing::Test
+{
+protected:
+  CostToGoTest() :
+      occupancy_{grid::Layout<2>{grid::Coordinates<2>{30, 20}}},
+      state_space_{occupancy_},
+      goal_{occupancy_.layout().state(grid::Coordinates<2>{25, 10})}
+  {}
+
+  TestPlanner make_planner() const
+  {
+    return TestPlanner{expansion_queue::MinSorted<grid::Cell<2>, int>{}, TestField{occupancy_.layout()}};
+  }
+
+  void expect_same_field(const TestPlanner& repaired)
+  {
+    auto planner = make_planner();
+    build_cost_to_go(planner, metric_, state_space_, goal_);
+
+    for (std::uint32_t index = 0; index < occupancy_.layout().size(); ++index)
+    {
+      const auto cell = occupancy_.layout().state(index);
+      ASSERT_EQ(repaired.expansion_table().cost_to_go(cell), planner.expansion_table().cost_to_go(cell));
+    }
+  }
+
+  grid::Occupancy<2> occupancy_;
+
+  TestOctileMetric metric_;
+
+  TestOccupancyStateSpace state_space_;
+
+  grid::Cell<2> goal_;
+};
+
+
+TEST_F(CostToGoTest, FollowNextSteps)
+{
+  auto planner = make_planner();
+  const auto [code, iterations] = build_cost_to_go(planner, metric_, state_space_, goal_);
+  ASSERT_EQ(code, PlannerCode::INFEASIBLE);
+
+  const auto& field = planner.expansion_table();
+  const auto start = occupancy_.layout().state(grid::Coordinates<2>{0, 0});
+  ASSERT_EQ(field.cost_to_go(start), 10 * 15 + 14 * 10);
+
+  std::vector<grid::Cell<2>> path;
+  field.follow(start, std::back_inserter(path));
+  ASSERT_EQ(path.size(), 26UL);
+  ASSERT_EQ(path.front(), start);
+  ASSERT_EQ(path.back(), goal_);
+
+  // Cost-to-go decreases by exactly one edge along the path
+  for (std::size_t i = 1; i < path.size(); ++i)
+  {
+    ASSERT_EQ(field.cost_to_go(path[i - 1]) - field.cost_to_go(path[i]), metric_(path[i], path[i - 1]));
+  }
+}
+
+
+TEST_F(CostToGoTest, CostRadius)
+{
+  auto planner = make_planner();
+  const auto [code, iterations] = build_cost_to_go(planner, metric_, state_space_, goal_, 50);
+  ASSERT_EQ(code, PlannerCode::INFEASIBLE);
+
+  ASSERT_TRUE(planner.expansion_table().is_reachable(occupancy_.layout().state(grid::Coordinates<2>{20, 10})));
+  ASSERT_FALSE(planner.expansion_table().is_reachable(occupancy_.layout().state(grid::Coordinates<2>{0, 0})));
+
+  // Exactly the states within the radius are reached, including those just past it on the search frontier
+  auto full = make_planner();
+  build_cost_to_go(full, metric_, state_space_, goal_);
+
+  std::size_t past_radius = 0;
+  for (std::uint32_t index = 0; index < occupancy_.layout().size(); ++index)
+  {
+    const auto cell = occupancy_.layout().state(index);
+    const bool within = full.expansion_table().is_reachable(cell) and full.expansion_table().cost_to_go(cell) <= 50;
+    ASSERT_EQ(planner.expansion_table().is_reachable(cell), within);
+    if (within)
+    {
+      ASSERT_EQ(planner.expansion_table().cost_to_go(cell), full.expansion_table().cost_to_go(cell));
+    }
+    else if (full.expansion_table().is_reachable(cell) and full.expansion_table().cost_to_go(cell) <= 50 + 14)
+    {
+      ++past_radius;
+    }
+  }
+  ASSERT_GT(past_radius, 0UL);
+}
+
+
+TEST_F(CostToGoTest, RepairMatchesRebuild)
+{
+  auto planner = make_planner();
+  build_cost_to_go(planner, metric_, state_space_, goal_);
+
+  // Block most of column x = 15
+  std::vector<grid::Cell<2>> changed;
+  for (std::int32_t y = 2; y < 20; ++y)
+  {
+    occupancy_.set_occupied(grid::Coordinates<2>{15, y});
+    changed.push_back(occupancy_.layout().state(grid::Coordinates<2>{15, y}));
+  }
+  const auto [blocked_code, blocked_iterations] =
+    repair_cost_to_go(planner, metric_, state_space_, changed.begin(), changed.end());
+  ASSERT_EQ(blocked_code, PlannerCode::INFEASIBLE);
+  expect_same_field(planner);
+
+  // Open a gap in the new wall
+  changed.clear();
+  for (std::int32_t y = 12; y < 14; ++y)
+  {
+    occupancy_.set_occupied(grid::Coordinates<2>{15, y}, false);
+    changed.push_back(occupancy_.layout().state(grid::Coordinates<2>{15, y}));
+  }
+  const auto [opened_code, opened_iterations] =
+    repair_cost_to_go(planner, metric_, state_space_, changed.begin(), changed.end());
+  ASSERT_EQ(opened_code, PlannerCode::INFEASIBLE);
+  expect_same_field(planner);
+}
+
+
+TEST_F(CostToGoTest, NextStepStoragesAgree)
+{
+  using IndexField = CostToGoField<grid::Cell<2>, int, grid::Layout<2>, NextStepIndex<grid::Layout<2>>>;
+  using IndexPlanner =
+    ShortestPathPlanner<grid::Cell<2>, int, expansion_queue::MinSorted<grid::Cell<2>, int>, IndexField>;
+
+  auto planner = make_planner();
+  IndexPlanner index_planner{expansion_queue::MinSorted<grid::Cell<2>, int>{}, IndexField{occupancy_.layout()}};
+  build_cost_to_go(planner, metric_, state_space_, goal_);
+  build_cost_to_go(index_planner, metric_, state_space_, goal_);
+
+  // Block a wall with a gap, which reroutes most of the field around it
+  std::vector<grid::Cell<2>> changed;
+  for (std::int32_t y = 0; y < 20; ++y)
+  {
+    if (y != 4)
+    {
+      occupancy_.set_occupied(grid::Coordinates<2>{20, y});
+      changed.push_back(occupancy_.layout().state(grid::Coordinates<2>{20, y}));
+    }
+  }
+
+  // Invalidate copies, so the repairs below start from the same fields
+  auto field = planner.expansion_table();
+  auto index_field = index_planner.expansion_table();
+  auto invalidated = field.invalidate(changed.begin(), changed.end());
+  auto index_invalidated = index_field.invalidate(changed.begin(), changed.end());
+  std::sort(invalidated.begin(), invalidated.end());
+  std::sort(index_invalidated.begin(), index_invalidated.end());
+  ASSERT_EQ(invalidated, index_invalidated);
+  ASSERT_GT(invalidated.size(), changed.size());
+
+  repair_cost_to_go(planner, metric_, state_space_, changed.begin(), changed.end());
+  repair_cost_to_go(index_planner, metric_, state_space_, changed.begin(), changed.end());
+  expect_same_field(planner);
+
+  for (std::uint32_t index = 0; index < occupancy_.layout().size(); ++index)
+  {
+    const auto cell = occupancy_.layout().state(index);
+    ASSERT_EQ(planner.expansion_table().is_reachable(cell), index_planner.expansion_table().is_reachable(cell));
+    if (planner.expansion_table().is_reachable(cell))
+    {
+      ASSERT_EQ(planner.expansion_table().next(cell), index_planner.expansion_table().next(cell));
+    }
+  }
+}
+
+
+TEST_F(CostToGoTest, RangeQueryMatchesField)
+{
+  static constexpr int kRadius = 50;
+
+  auto planner = make_planner();
+  build_cost_to_go(planner, metric_, state_space_, goal_);
+  const auto& field = planner.expansion_table();
+
+  using QueueType = expansion_queue::MinSorted<grid::Cell<2>, int>;
+  using MaskType = expansion_table::RangeMask<grid::Cell<2>, int, grid::Layout<2>>;
+  ShortestPathPlanner<grid::Cell<2>, int, QueueType, expansion_table::RangeSet<grid::Cell<2>, int>> set_planner;
+  ShortestPathPlanner<grid::Cell<2>, int, QueueType, MaskType> mask_planner{QueueType{}, MaskType{occupancy_.layout()}};
+
+  // Run twice, so the second query starts from a reset table
+  run_range_query(set_planner, metric_, state_space_, goal_, 2 * kRadius);
+  run_range_query(mask_planner, metric_, state_space_, goal_, 2 * kRadius);
+  const auto& reached_set = run_range_query(set_planner, metric_, state_space_, goal_, kRadius);
+  const auto& reached_mask = run_range_query(mask_planner, metric_, state_space_, goal_, kRadius);
+
+  std::size_t expected_size = 0;
+  for (std::uint32_t index = 0; index < occupancy_.layout().size(); ++index)
+  {
+    const auto cell = occupancy_.layout().state(index);
+    const bool in_range = field.is_reachable(cell) and field.cost_to_go(cell) <= kRadius;
+    expected_size += in_range;
+
+    ASSERT_EQ(reached_set.is_expanded(cell), in_range);
+    ASSERT_EQ(reached_mask.mask().test(index), in_range);
+    ASSERT_EQ(reached_mask.value(index), in_range ? field.cost_to_go(cell) : Invalid<int>::value);
+  }
+  ASSERT_EQ(reached_set.size(), expected_size);
+  ASSERT_EQ(reached_mask.size(), expected_size);
+
+  for (const auto& [state, value] : reached_set)
+  {
+    ASSERT_EQ(value, field.cost_to_go(state));
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
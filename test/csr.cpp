@@ -0,0 +1,110 @@
+
+// C++ Standard Library
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/planner.h>
+#include <mmpl/state_space/csr.h>
+
+using namespace mmpl;
+using namespace mmpl::state_space;
+
+
+class CsrGraphTest : public ::testing::Test
+{
+protected:
+  // 0 --10--> 1 --1--> 3
+  // 0 --1---> 2 --1--> 1
+  CsrGraphTest() :
+      edges_{CsrEdge<int>{1, 3, 1}, CsrEdge<int>{0, 1, 10}, CsrEdge<int>{2, 1, 1}, CsrEdge<int>{0, 2, 1}},
+      graph_{4, edges_.begin(), edges_.end()}
+  {}
+
+  std::vector<CsrEdge<int>> edges_;
+
+  CsrGraph<int> graph_;
+};
+
+
+TEST_F(CsrGraphTest, Layout)
+{
+  ASSERT_EQ(graph_.vertex_count(), 4U);
+  ASSERT_EQ(graph_.edge_count(), 4U);
+
+  ASSERT_EQ(graph_.edges_end(0) - graph_.edges_begin(0), 2U);
+  ASSERT_EQ(graph_.target(graph_.edges_begin(0)), 1U);
+  ASSERT_EQ(graph_.weight(graph_.edges_begin(0)), 10);
+  ASSERT_EQ(graph_.target(graph_.edges_begin(0) + 1), 2U);
+
+  ASSERT_EQ(graph_.edges_end(3) - graph_.edges_begin(3), 0U);
+}
+
+
+TEST_F(CsrGraphTest, ForEachChild)
+{
+  CsrStateSpace<int> state_space{graph_};
+  CsrMetric<int> metric{graph_};
+
+  std::vector<int> weights;
+  ASSERT_TRUE(state_space.for_each_child(
+    CsrVertex{0}, [&](const CsrVertex& child) { weights.push_back(metric(CsrVertex{0}, child)); }));
+
+  ASSERT_EQ(weights, (std::vector<int>{10, 1}));
+}
+
+
+TEST_F(CsrGraphTest, ShortestPath)
+{
+  using ExpansionQueueType = expansion_queue::MinSorted<CsrVertex, int>;
+  using ExpansionTableType = expansion_table::Unordered<CsrVertex, int>;
+
+  ShortestPathPlanner<CsrVertex, int, ExpansionQueueType, ExpansionTableType> planner;
+  CsrStateSpace<int> state_space{graph_};
+  CsrMetric<int> metric{graph_};
+
+  const auto [code, iterations] = run_plan(planner, metric, state_space, CsrVertex{0}, CsrVertex{3});
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(planner.expansion_table().get_total_value(CsrVertex{3}), 3);
+
+  std::vector<CsrVertex> path;
+  generate_reverse_path(std::back_inserter(path), CsrVertex{3}, planner.expansion_table());
+
+  ASSERT_EQ(path.size(), 4UL);
+  ASSERT_EQ(path[0].vertex(), 3U);
+  ASSERT_EQ(path[1].vertex(), 1U);
+  ASSERT_EQ(path[2].vertex(), 2U);
+  ASSERT_EQ(path[3].vertex(), 0U);
+
+  // Forward path into a preallocated buffer
+  ASSERT_EQ(planner.expansion_table().path_length(CsrVertex{3}), 4UL);
+  std::vector<CsrVertex> forward_path(5, CsrVertex{CsrVertex::NO_EDGE});
+  const auto forward_last =
+    generate_path(forward_path.begin(), forward_path.end(), CsrVertex{3}, planner.expansion_table());
+  ASSERT_EQ(forward_last - forward_path.begin(), 4L);
+  ASSERT_TRUE(std::equal(path.rbegin(), path.rend(), forward_path.begin()));
+
+  // Lazy reverse view
+  const auto view = reverse_path(CsrVertex{3}, planner.expansion_table());
+  ASSERT_EQ(view.size(), 4UL);
+  ASSERT_TRUE(std::equal(view.begin(), view.end(), path.begin(), path.end()));
+
+  // Bounded reverse path
+  CsrVertex bounded_path[2] = {CsrVertex{CsrVertex::NO_EDGE}, CsrVertex{CsrVertex::NO_EDGE}};
+  ASSERT_EQ(
+    generate_reverse_path(bounded_path, bounded_path + 2, CsrVertex{3}, planner.expansion_table()), bounded_path + 2);
+  ASSERT_EQ(bounded_path[1].vertex(), 1U);
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
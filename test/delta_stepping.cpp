@@ -0,0 +1,150 @@
+
+// C++ Standard Library
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/concurrent_hashed.h>
+#include <mmpl/expansion_table/dense_atomic.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner/delta_stepping.h>
+#include <mmpl/state_space/csr.h>
+
+using namespace mmpl;
+using namespace mmpl::state_space;
+
+
+/**
+ * @brief Random sparse directed graph, searched from vertex 0
+ */
+class DeltaSteppingTest : public ::testing::Test
+{
+protected:
+  static constexpr std::uint32_t kVertexCount = 2000;
+
+  DeltaSteppingTest() :
+      edges_{make_edges()},
+      graph_{kVertexCount, edges_.begin(), edges_.end()},
+      state_space_{graph_},
+      metric_{graph_},
+      delta_stepping_{25, 4}
+  {}
+
+  static std::vector<CsrEdge<int>> make_edges()
+  {
+    std::mt19937 rng{7};
+    std::uniform_int_distribution<std::uint32_t> vertex_dist{0, kVertexCount - 1};
+    std::uniform_int_distribution<int> weight_dist{1, 100};
+
+    std::vector<CsrEdge<int>> edges;
+    for (std::uint32_t i = 0; i < kVertexCount * 6; ++i)
+    {
+      edges.push_back(CsrEdge<int>{vertex_dist(rng), vertex_dist(rng), weight_dist(rng)});
+    }
+    return edges;
+  }
+
+  std::vector<CsrEdge<int>> edges_;
+
+  CsrGraph<int> graph_;
+
+  CsrStateSpace<int> state_space_;
+
+  CsrMetric<int> metric_;
+
+  planner::DeltaStepping<CsrVertex, int> delta_stepping_;
+};
+
+
+TEST_F(DeltaSteppingTest, MatchesShortestPathPlanner)
+{
+  // Exhaustive reference search
+  ShortestPathPlanner<
+    CsrVertex,
+    int,
+    expansion_queue::MinSorted<CsrVertex, int>,
+    expansion_table::Unordered<CsrVertex, int>>
+    planner;
+  const auto [code, iterations] = run_plan(planner, metric_, state_space_, CsrVertex{0}, CsrVertex{kVertexCount});
+  ASSERT_EQ(code, PlannerCode::INFEASIBLE);
+
+  expansion_table::DenseAtomic<CsrVertex, int, CsrGraph<int>> expansion_table{graph_};
+  ASSERT_GT(delta_stepping_.run(expansion_table, metric_, state_space_, CsrVertex{0}), 0UL);
+
+  for (std::uint32_t v = 0; v < kVertexCount; ++v)
+  {
+    const auto expected = planner.expansion_table().try_get_total_value(CsrVertex{v});
+    ASSERT_EQ(expansion_table.try_get_total_value(CsrVertex{v}), expected);
+
+    if (expansion_table.is_expanded(CsrVertex{v}) and v != 0)
+    {
+      // Parent records must be consistent with values
+      const auto parent = expansion_table.get_parent(CsrVertex{v});
+      ASSERT_LT(expansion_table.get_total_value(parent), expected);
+    }
+  }
+}
+
+
+TEST_F(DeltaSteppingTest, ConcurrentHashedMatchesDenseAtomic)
+{
+  expansion_table::DenseAtomic<CsrVertex, int, CsrGraph<int>> dense_table{graph_};
+  ASSERT_GT(delta_stepping_.run(dense_table, metric_, state_space_, CsrVertex{0}), 0UL);
+
+  // Slots are claimed concurrently by all workers
+  expansion_table::ConcurrentHashed<CsrVertex, int> hashed_table{kVertexCount};
+  ASSERT_GT(delta_stepping_.run(hashed_table, metric_, state_space_, CsrVertex{0}), 0UL);
+  ASSERT_LE(hashed_table.size(), hashed_table.capacity());
+
+  for (std::uint32_t v = 0; v < kVertexCount; ++v)
+  {
+    const auto expected = dense_table.try_get_total_value(CsrVertex{v});
+    ASSERT_EQ(hashed_table.try_get_total_value(CsrVertex{v}), expected);
+
+    if (hashed_table.is_expanded(CsrVertex{v}) and v != 0)
+    {
+      const auto parent = hashed_table.get_parent(CsrVertex{v});
+      ASSERT_LT(hashed_table.get_total_value(parent), expected);
+    }
+  }
+}
+
+
+
+TEST_F(DeltaSteppingTest, BucketsBoundedByHeaviestEdge)
+{
+  // Long chain, whose total path value spans thousands of buckets
+  static constexpr std::uint32_t kChainLength = 5000;
+  std::vector<CsrEdge<int>> edges;
+  for (std::uint32_t v = 1; v < kChainLength; ++v)
+  {
+    edges.push_back(CsrEdge<int>{v - 1, v, (v % 7 == 0) ? 100 : 10});
+  }
+  CsrGraph<int> graph{kChainLength, edges.begin(), edges.end()};
+  CsrStateSpace<int> state_space{graph};
+  CsrMetric<int> metric{graph};
+
+  expansion_table::DenseAtomic<CsrVertex, int, CsrGraph<int>> expansion_table{graph};
+  ASSERT_GT(delta_stepping_.run(expansion_table, metric, state_space, CsrVertex{0}), 0UL);
+  ASSERT_LE(delta_stepping_.bucket_capacity(), 100UL / 25UL + 2UL);
+
+  int value = 0;
+  for (std::uint32_t v = 1; v < kChainLength; ++v)
+  {
+    value += (v % 7 == 0) ? 100 : 10;
+    ASSERT_EQ(expansion_table.get_total_value(CsrVertex{v}), value);
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,787 @@
+
+// C++ Standard Library
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/grid_bit_packed.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/expansion_table/voxel_blocks.h>
+#include <mmpl/grid/layout.h>
+#include <mmpl/grid/line_of_sight.h>
+#include <mmpl/grid/metric.h>
+#include <mmpl/grid/multi_source_bfs.h>
+#include <mmpl/grid/neighborhood.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/grid/voxel_map.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner/theta_star.h>
+#include <mmpl/state_space/grid.h>
+#include <mmpl/state_space/memoized.h>
+#include <mmpl/state_space/sparse_voxel.h>
+
+using namespace mmpl;
+
+namespace mmpl
+{
+
+class TestUnitMetric;
+class TestOccupancyStateSpace;
+
+template <> struct MetricTraits<TestUnitMetric>
+{
+  using StateType = grid::Cell<2>;
+  using ValueType = int;
+};
+
+
+template <> struct StateSpaceTraits<TestOccupancyStateSpace>
+{
+  using StateType = grid::Cell<2>;
+};
+
+
+class TestUnitMetric : public MetricBase<TestUnitMetric>
+{
+private:
+  inline int
+  get_value_impl([[maybe_unused]] const grid::Cell<2>& parent, [[maybe_unused]] const grid::Cell<2>& child) const
+  {
+    return 1;
+  }
+
+  friend class MetricBase<TestUnitMetric>;
+};
+
+
+class TestOccupancyStateSpace : public StateSpaceBase<TestOccupancyStateSpace>
+{
+public:
+  explicit TestOccupancyStateSpace(const grid::Occupancy<2>& occupancy) : occupancy_{std::addressof(occupancy)} {}
+
+private:
+  template <typename UnaryChildFn> inline bool for_each_child_impl(const grid::Cell<2>& parent, UnaryChildFn&& child_fn)
+  {
+    const std::uint8_t mask = occupancy_->free_neighbors(parent);
+    for (std::uint8_t code = 0; code < 8; ++code)
+    {
+      if (mask & (1 << code))
+      {
+        child_fn(occupancy_->layout().neighbor(parent, grid::Neighborhood<2, 8>::offsets[code]));
+      }
+    }
+    return true;
+  }
+
+  const grid::Occupancy<2>* occupancy_;
+
+  friend class StateSpaceBase<TestOccupancyStateSpace>;
+};
+
+}  // namespace mmpl
+
+
+TEST(Layout, IndexRoundTrip)
+{
+  const grid::Layout<3> layout{grid::Coordinates<3>{4, 5, 6}};
+  ASSERT_EQ(layout.size(), 6UL * 7UL * 8UL);
+
+  for (std::int32_t z = -1; z <= 6; ++z)
+  {
+    for (std::int32_t y = -1; y <= 5; ++y)
+    {
+      for (std::int32_t x = -1; x <= 4; ++x)
+      {
+        const auto cell = layout.state(grid::Coordinates<3>{x, y, z});
+        ASSERT_EQ(layout.state(cell.index()).coordinates(), cell.coordinates());
+      }
+    }
+  }
+}
+
+
+TEST(Neighborhood, OppositeDirections)
+{
+  using NeighborhoodType = grid::Neighborhood<2, 8>;
+  for (std::uint8_t code = 0; code < 8; ++code)
+  {
+    const auto& offset = NeighborhoodType::offsets[code];
+    ASSERT_EQ(NeighborhoodType::code(offset), code);
+    ASSERT_EQ(NeighborhoodType::code(grid::Coordinates<2>{-offset[0], -offset[1]}), NeighborhoodType::opposite(code));
+  }
+}
+
+
+TEST(Occupancy, FreeNeighbors)
+{
+  grid::Occupancy<2> occupancy{grid::Layout<2>{grid::Coordinates<2>{100, 3}}};
+  occupancy.set_occupied(grid::Coordinates<2>{64, 1});
+  occupancy.set_occupied(grid::Coordinates<2>{26, 0});
+
+  // Corner cell has only three in-bounds neighbors
+  ASSERT_EQ(occupancy.free_neighbors(occupancy.layout().state(grid::Coordinates<2>{0, 0})), 0b11010000);
+
+  // Border below; occupied cell to the upper-right
+  ASSERT_EQ(occupancy.free_neighbors(occupancy.layout().state(grid::Coordinates<2>{63, 0})), 0b01111000);
+
+  // Border below; occupied cell to the right lies in the next bitmap word
+  ASSERT_EQ(occupancy.free_neighbors(occupancy.layout().state(grid::Coordinates<2>{25, 0})), 0b11101000);
+}
+
+
+TEST(GridBitPacked, MatchesUnordered)
+{
+  grid::Occupancy<2> occupancy{grid::Layout<2>{grid::Coordinates<2>{70, 20}}};
+  for (std::int32_t y = 0; y < 18; ++y)
+  {
+    occupancy.set_occupied(grid::Coordinates<2>{40, y});
+  }
+
+  TestUnitMetric metric;
+  TestOccupancyStateSpace state_space{occupancy};
+
+  const auto start = occupancy.layout().state(grid::Coordinates<2>{2, 3});
+  const auto goal = occupancy.layout().state(grid::Coordinates<2>{65, 1});
+
+  using QueueType = expansion_queue::MinSorted<grid::Cell<2>, int>;
+  ShortestPathPlanner<grid::Cell<2>, int, QueueType, expansion_table::Unordered<grid::Cell<2>, int>> planner;
+  ShortestPathPlanner<grid::Cell<2>, int, QueueType, expansion_table::GridBitPacked<int>> packed_planner{
+    QueueType{}, expansion_table::GridBitPacked<int>{occupancy.layout()}};
+
+  const auto [code, iterations] = run_plan(planner, metric, state_space, start, goal);
+  const auto [packed_code, packed_iterations] = run_plan(packed_planner, metric, state_space, start, goal);
+
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(packed_code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(planner.expansion_table().get_total_value(goal), packed_planner.expansion_table().get_total_value(goal));
+
+  // Parents recorded by the packed table are always one step closer to the start
+  for (auto cell = goal; !(cell == start); cell = packed_planner.expansion_table().get_parent(cell))
+  {
+    const auto parent = packed_planner.expansion_table().get_parent(cell);
+    ASSERT_EQ(
+      packed_planner.expansion_table().get_total_value(parent) + 1,
+      packed_planner.expansion_table().get_total_value(cell));
+    ASSERT_FALSE(occupancy.is_occupied(parent));
+  }
+
+  // Neighbors of expanded cells near the start are already expanded
+  ASSERT_EQ(packed_planner.expansion_table().unexpanded_free_neighbors(occupancy, start), 0);
+}
+
+
+TEST(MultiSourceBFS, MatchesSingleSourceBFS)
+{
+  grid::Occupancy<2> occupancy{grid::Layout<2>{grid::Coordinates<2>{50, 30}}};
+  for (std::int32_t y = 5; y < 30; ++y)
+  {
+    occupancy.set_occupied(grid::Coordinates<2>{20, y});
+  }
+
+  std::vector<grid::Cell<2>> sources;
+  for (std::int32_t i = 0; i < 70; ++i)
+  {
+    sources.push_back(occupancy.layout().state(grid::Coordinates<2>{(i * 7) % 50, (i * 3) % 5}));
+  }
+
+  grid::MultiSourceBFS<2, 4, 128> bfs{occupancy};
+  bfs.run(sources.begin(), sources.end());
+  ASSERT_EQ(bfs.source_count(), sources.size());
+
+  for (std::size_t s = 0; s < sources.size(); ++s)
+  {
+    // Reference breadth-first search from a single source
+    std::vector<std::uint16_t> expected(occupancy.layout().size(), decltype(bfs)::UNREACHED);
+    std::deque<grid::Cell<2>> queue{sources[s]};
+    expected[sources[s].index()] = 0;
+    while (!queue.empty())
+    {
+      const auto cell = queue.front();
+      queue.pop_front();
+      for (const auto& offset : grid::Neighborhood<2, 4>::offsets)
+      {
+        const auto child = occupancy.layout().neighbor(cell, offset);
+        if (!occupancy.is_occupied(child) and expected[child.index()] == decltype(bfs)::UNREACHED)
+        {
+          expected[child.index()] = expected[cell.index()] + 1;
+          queue.push_back(child);
+        }
+      }
+    }
+
+    for (std::uint32_t index = 0; index < occupancy.layout().size(); ++index)
+    {
+      const auto cell = occupancy.layout().state(index);
+      ASSERT_EQ(bfs.distance(s, cell), expected[index]);
+      ASSERT_EQ(bfs.is_reached(s, cell), expected[index] != decltype(bfs)::UNREACHED);
+    }
+  }
+}
+
+
+TEST(Bitmap, AnyMatchesPerBitScan)
+{
+  std::mt19937 rng{7};
+  grid::Bitmap bitmap{300};
+  for (std::uint32_t i = 0; i < 300; i += 1 + rng() % 90)
+  {
+    bitmap.set(i);
+  }
+
+  for (int trial = 0; trial < 2000; ++trial)
+  {
+    const std::uint32_t first = rng() % 300;
+    const std::uint32_t last = first + rng() % (301 - first);
+
+    bool expected = false;
+    for (std::uint32_t i = first; i < last; ++i)
+    {
+      expected = expected or bitmap.test(i);
+    }
+    ASSERT_EQ(bitmap.any(first, last), expected) << "[" << first << ", " << last << ")";
+  }
+}
+
+
+/**
+ * @brief Reference line-of-sight check; tests the segment between cell centers against every cell and cell corner
+ */
+bool brute_force_line_of_sight(const grid::Occupancy<2>& occupancy, const grid::Cell<2>& from, const grid::Cell<2>& to)
+{
+  // Doubled coordinates, in which cell (i, j) covers [2i, 2i + 2] x [2j, 2j + 2]
+  const std::int64_t ax = 2 * from[0] + 1, ay = 2 * from[1] + 1;
+  const std::int64_t dx = 2 * (to[0] - from[0]), dy = 2 * (to[1] - from[1]);
+  const auto side = [&](const std::int64_t x, const std::int64_t y) { return dx * (y - ay) - dy * (x - ax); };
+
+  // Segment crosses the interior of its end cells, and of any cell with corners strictly on both sides of it
+  const auto crosses = [&](const std::int32_t x, const std::int32_t y) {
+    if ((x == from[0] and y == from[1]) or (x == to[0] and y == to[1]))
+    {
+      return true;
+    }
+    int above = 0, below = 0;
+    for (const auto& corner : {std::array<std::int64_t, 2>{2 * x, 2 * y},
+                               std::array<std::int64_t, 2>{2 * x + 2, 2 * y},
+                               std::array<std::int64_t, 2>{2 * x, 2 * y + 2},
+                               std::array<std::int64_t, 2>{2 * x + 2, 2 * y + 2}})
+    {
+      above += (side(corner[0], corner[1]) > 0);
+      below += (side(corner[0], corner[1]) < 0);
+    }
+    return above > 0 and below > 0;
+  };
+
+  const std::int32_t x_min = std::min(from[0], to[0]), x_max = std::max(from[0], to[0]);
+  const std::int32_t y_min = std::min(from[1], to[1]), y_max = std::max(from[1], to[1]);
+  for (std::int32_t y = y_min; y <= y_max; ++y)
+  {
+    for (std::int32_t x = x_min; x <= x_max; ++x)
+    {
+      if (crosses(x, y) and occupancy.is_occupied(grid::Coordinates<2>{x, y}))
+      {
+        return false;
+      }
+
+      // Corner shared with the previous row and column, passed by the segment
+      if (x == x_min or y == y_min or side(2 * x, 2 * y) != 0)
+      {
+        continue;
+      }
+      int touched_occupied = 0;
+      for (const auto& cell : {grid::Coordinates<2>{x - 1, y - 1},
+                               grid::Coordinates<2>{x, y - 1},
+                               grid::Coordinates<2>{x - 1, y},
+                               grid::Coordinates<2>{x, y}})
+      {
+        touched_occupied += (!crosses(cell[0], cell[1]) and occupancy.is_occupied(cell));
+      }
+      if (touched_occupied == 2)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+TEST(LineOfSight, MatchesBruteForce)
+{
+  std::mt19937 rng{3};
+  grid::Occupancy<2> occupancy{grid::Layout<2>{grid::Coordinates<2>{90, 40}}};
+  for (int i = 0; i < 60; ++i)
+  {
+    occupancy.set_occupied(
+      grid::Coordinates<2>{static_cast<std::int32_t>(rng() % 90), static_cast<std::int32_t>(rng() % 40)});
+  }
+
+  // Segment through the corner of a single occupied cell is clear, as for diagonal moves on an 8-connected grid
+  grid::Occupancy<2> corner_occupancy{grid::Layout<2>{grid::Coordinates<2>{10, 10}}};
+  corner_occupancy.set_occupied(grid::Coordinates<2>{3, 4});
+  ASSERT_TRUE(grid::line_of_sight(
+    corner_occupancy,
+    corner_occupancy.layout().state(grid::Coordinates<2>{0, 0}),
+    corner_occupancy.layout().state(grid::Coordinates<2>{7, 7})));
+  ASSERT_TRUE(grid::line_of_sight(
+    corner_occupancy,
+    corner_occupancy.layout().state(grid::Coordinates<2>{7, 7}),
+    corner_occupancy.layout().state(grid::Coordinates<2>{0, 0})));
+
+  // Segment through the shared corner of two diagonally adjacent occupied cells is blocked
+  corner_occupancy.set_occupied(grid::Coordinates<2>{4, 3});
+  ASSERT_FALSE(grid::line_of_sight(
+    corner_occupancy,
+    corner_occupancy.layout().state(grid::Coordinates<2>{0, 0}),
+    corner_occupancy.layout().state(grid::Coordinates<2>{7, 7})));
+  ASSERT_FALSE(grid::line_of_sight(
+    corner_occupancy,
+    corner_occupancy.layout().state(grid::Coordinates<2>{7, 7}),
+    corner_occupancy.layout().state(grid::Coordinates<2>{0, 0})));
+  ASSERT_TRUE(grid::line_of_sight(
+    corner_occupancy,
+    corner_occupancy.layout().state(grid::Coordinates<2>{0, 1}),
+    corner_occupancy.layout().state(grid::Coordinates<2>{9, 1})));
+
+  for (int trial = 0; trial < 3000; ++trial)
+  {
+    const auto from = occupancy.layout().state(
+      grid::Coordinates<2>{static_cast<std::int32_t>(rng() % 90), static_cast<std::int32_t>(rng() % 40)});
+    const auto to = occupancy.layout().state(
+      grid::Coordinates<2>{static_cast<std::int32_t>(rng() % 90), static_cast<std::int32_t>(rng() % 40)});
+    ASSERT_EQ(grid::line_of_sight(occupancy, from, to), brute_force_line_of_sight(occupancy, from, to))
+      << from << " --> " << to;
+  }
+
+  // Short segments over dense obstacles pass many corners of occupied cells
+  grid::Occupancy<2> dense_occupancy{grid::Layout<2>{grid::Coordinates<2>{12, 12}}};
+  for (std::int32_t y = 0; y < 12; ++y)
+  {
+    for (std::int32_t x = 0; x < 12; ++x)
+    {
+      if (rng() % 4 == 0)
+      {
+        dense_occupancy.set_occupied(grid::Coordinates<2>{x, y});
+      }
+    }
+  }
+  for (int trial = 0; trial < 3000; ++trial)
+  {
+    const auto from = dense_occupancy.layout().state(
+      grid::Coordinates<2>{static_cast<std::int32_t>(rng() % 12), static_cast<std::int32_t>(rng() % 12)});
+    const auto to = dense_occupancy.layout().state(
+      grid::Coordinates<2>{static_cast<std::int32_t>(rng() % 12), static_cast<std::int32_t>(rng() % 12)});
+    ASSERT_EQ(grid::line_of_sight(dense_occupancy, from, to), brute_force_line_of_sight(dense_occupancy, from, to))
+      << from << " --> " << to;
+  }
+}
+
+
+TEST(LineOfSight, AnyAnglePaths)
+{
+  grid::Occupancy<2> occupancy{grid::Layout<2>{grid::Coordinates<2>{60, 40}}};
+  for (std::int32_t y = 0; y < 30; ++y)
+  {
+    occupancy.set_occupied(grid::Coordinates<2>{30, y});
+  }
+
+  grid::EuclideanMetric<2, double> metric;
+  TestOccupancyStateSpace state_space{occupancy};
+
+  const auto start = occupancy.layout().state(grid::Coordinates<2>{5, 3});
+  const auto goal = occupancy.layout().state(grid::Coordinates<2>{55, 2});
+
+  using QueueType = expansion_queue::MinSorted<grid::Cell<2>, double>;
+  using TableType = expansion_table::Unordered<grid::Cell<2>, double>;
+
+  ShortestPathPlanner<grid::Cell<2>, double, QueueType, TableType> planner;
+  planner::ThetaStar<double, QueueType, TableType> theta_star_planner{occupancy};
+
+  const auto [code, iterations] = run_plan(planner, metric, state_space, start, goal);
+  const auto [theta_star_code, theta_star_iterations] = run_plan(theta_star_planner, metric, state_space, start, goal);
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(theta_star_code, PlannerCode::GOAL_FOUND);
+
+  // Grid path, string-pulled
+  std::vector<grid::Cell<2>> path(planner.expansion_table().path_length(goal));
+  generate_path(path.begin(), path.size(), goal, planner.expansion_table());
+  const std::size_t grid_path_length = path.size();
+  path.erase(grid::string_pull(occupancy, path.begin(), path.end()), path.end());
+
+  // Theta* path
+  std::vector<grid::Cell<2>> theta_star_path(theta_star_planner.expansion_table().path_length(goal));
+  generate_path(theta_star_path.begin(), theta_star_path.size(), goal, theta_star_planner.expansion_table());
+
+  for (const auto* any_angle_path : {&path, &theta_star_path})
+  {
+    ASSERT_LT(any_angle_path->size(), grid_path_length);
+    ASSERT_EQ(any_angle_path->front(), start);
+    ASSERT_EQ(any_angle_path->back(), goal);
+
+    double length = 0;
+    for (std::size_t i = 1; i < any_angle_path->size(); ++i)
+    {
+      // Grid steps may cut corners of occupied cells; longer segments never do
+      const auto& prev = (*any_angle_path)[i - 1];
+      const auto& curr = (*any_angle_path)[i];
+      if (std::abs(curr[0] - prev[0]) > 1 or std::abs(curr[1] - prev[1]) > 1)
+      {
+        ASSERT_TRUE(grid::line_of_sight(occupancy, prev, curr)) << prev << " --> " << curr;
+      }
+      length += metric((*any_angle_path)[i - 1], (*any_angle_path)[i]);
+    }
+    ASSERT_LT(length, planner.expansion_table().get_total_value(goal));
+  }
+  // Theta* values are lengths of its any-angle paths
+  double theta_star_length = 0;
+  for (std::size_t i = 1; i < theta_star_path.size(); ++i)
+  {
+    theta_star_length += metric(theta_star_path[i - 1], theta_star_path[i]);
+  }
+  ASSERT_NEAR(theta_star_planner.expansion_table().get_total_value(goal), theta_star_length, 1e-9);
+}
+
+
+template <std::size_t Dim, std::size_t Connectivity> void check_grid_state_space_children(const std::uint32_t seed)
+{
+  using NeighborhoodType = grid::Neighborhood<Dim, Connectivity>;
+
+  for (std::uint8_t code = 0; code < Connectivity; ++code)
+  {
+    grid::Coordinates<Dim> opposite;
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      opposite[d] = -NeighborhoodType::offsets[code][d];
+    }
+    ASSERT_EQ(NeighborhoodType::offsets[NeighborhoodType::opposite(code)], opposite);
+  }
+
+  grid::Coordinates<Dim> extents;
+  extents.fill(7);
+  extents[0] = 70;
+
+  std::mt19937 rng{seed};
+  grid::Occupancy<Dim> occupancy{grid::Layout<Dim>{extents}};
+  for (std::uint32_t index = 0; index < occupancy.layout().size(); ++index)
+  {
+    const auto cell = occupancy.layout().state(index);
+    if (occupancy.layout().within(cell.coordinates()) and rng() % 4 == 0)
+    {
+      occupancy.set_occupied(cell.coordinates());
+    }
+  }
+
+  state_space::Grid<Dim, Connectivity> state_space{occupancy};
+
+  for (std::uint32_t index = 0; index < occupancy.layout().size(); ++index)
+  {
+    const auto cell = occupancy.layout().state(index);
+    if (occupancy.is_occupied(cell))
+    {
+      continue;
+    }
+
+    std::vector<grid::Cell<Dim>> expected;
+    for (const auto& offset : NeighborhoodType::offsets)
+    {
+      grid::Coordinates<Dim> coordinates = cell.coordinates();
+      for (std::size_t d = 0; d < Dim; ++d)
+      {
+        coordinates[d] += offset[d];
+      }
+      if (!occupancy.is_occupied(coordinates))
+      {
+        expected.push_back(occupancy.layout().state(coordinates));
+      }
+    }
+
+    std::vector<grid::Cell<Dim>> children;
+    state_space.for_each_child(cell, [&children](const grid::Cell<Dim>& child) { children.push_back(child); });
+
+    std::vector<grid::Cell<Dim>> block_children;
+    state_space.for_each_child_block(cell, [&block_children](const auto& block) {
+      block_children.insert(block_children.end(), block.states.begin(), block.states.begin() + block.size);
+    });
+
+    ASSERT_EQ(children.size(), expected.size());
+    ASSERT_EQ(block_children.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      ASSERT_EQ(children[i].coordinates(), expected[i].coordinates());
+      ASSERT_EQ(children[i].id(), expected[i].id());
+      ASSERT_EQ(block_children[i].id(), expected[i].id());
+    }
+  }
+}
+
+
+TEST(GridStateSpace, ChildrenMatchBruteForce)
+{
+  check_grid_state_space_children<2, 4>(1);
+  check_grid_state_space_children<2, 8>(2);
+  check_grid_state_space_children<3, 6>(3);
+  check_grid_state_space_children<3, 26>(4);
+
+  using NeighborhoodType = grid::Neighborhood<3, 26>;
+  for (std::uint8_t code = 0; code < 26; ++code)
+  {
+    ASSERT_EQ(NeighborhoodType::code(NeighborhoodType::offsets[code]), code);
+  }
+}
+
+
+TEST(GridStateSpace, BatchedPlanMatchesUnbatched)
+{
+  grid::Occupancy<2> occupancy{grid::Layout<2>{grid::Coordinates<2>{70, 20}}};
+  for (std::int32_t y = 2; y < 20; ++y)
+  {
+    occupancy.set_occupied(grid::Coordinates<2>{40, y});
+  }
+
+  grid::StepMetric<2, int> metric{{0, 10, 14}};
+  TestOccupancyStateSpace state_space{occupancy};
+  state_space::Grid<2, 8> grid_state_space{occupancy};
+
+  const auto start = occupancy.layout().state(grid::Coordinates<2>{2, 13});
+  const auto goal = occupancy.layout().state(grid::Coordinates<2>{65, 17});
+
+  using PlannerType = ShortestPathPlanner<
+    grid::Cell<2>,
+    int,
+    expansion_queue::MinSorted<grid::Cell<2>, int>,
+    expansion_table::Unordered<grid::Cell<2>, int>>;
+  PlannerType planner;
+  PlannerType grid_planner;
+
+  const auto [code, iterations] = run_plan(planner, metric, state_space, start, goal);
+  const auto [grid_code, grid_iterations] = run_plan(grid_planner, metric, grid_state_space, start, goal);
+
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(grid_code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(iterations, grid_iterations);
+  ASSERT_EQ(planner.expansion_table().get_total_value(goal), grid_planner.expansion_table().get_total_value(goal));
+}
+
+
+TEST(VoxelBlockMap, SparseOccupancy)
+{
+  grid::VoxelBlockMap map{{-100, -100, -100}, {100, 100, 100}};
+  ASSERT_FALSE(map.is_occupied({-9, 0, 7}));
+  ASSERT_TRUE(map.is_occupied({100, 0, 0}));
+  ASSERT_TRUE(map.is_occupied({0, -101, 0}));
+
+  map.set_occupied({-9, 0, 7});
+  map.set_occupied({-17, 7, 0});
+  map.set_occupied({-1, -1, -1});
+  ASSERT_EQ(map.block_count(), 3UL);
+  ASSERT_TRUE(map.is_occupied({-9, 0, 7}));
+  ASSERT_TRUE(map.is_occupied({-1, -1, -1}));
+  ASSERT_FALSE(map.is_occupied({-9, 0, 6}));
+  ASSERT_FALSE(map.is_occupied({-8, 0, 7}));
+  ASSERT_FALSE(map.is_occupied({0, 0, 0}));
+
+  map.set_occupied({-9, 0, 7}, false);
+  ASSERT_FALSE(map.is_occupied({-9, 0, 7}));
+  ASSERT_EQ(map.block_count(), 3UL);
+}
+
+
+TEST(SparseVoxelGrid, MatchesDenseGrid)
+{
+  // Dense grid coordinates are sparse voxel coordinates shifted by the lower bound
+  constexpr std::int32_t lower = -6;
+  constexpr std::int32_t extent = 16;
+
+  const auto to_voxel = [](const grid::Cell<3>& cell) {
+    return grid::Voxel{{cell[0] + lower, cell[1] + lower, cell[2] + lower}};
+  };
+
+  std::mt19937 rng{11};
+  grid::Occupancy<3> occupancy{grid::Layout<3>{grid::Coordinates<3>{extent, extent, extent}}};
+  grid::VoxelBlockMap map{{lower, lower, lower}, {lower + extent, lower + extent, lower + extent}};
+  for (std::uint32_t index = 0; index < occupancy.layout().size(); ++index)
+  {
+    const auto cell = occupancy.layout().state(index);
+    const bool is_endpoint = cell.coordinates() == grid::Coordinates<3>{0, 0, 0} or
+      cell.coordinates() == grid::Coordinates<3>{extent - 1, extent - 1, extent - 1};
+    if (occupancy.layout().within(cell.coordinates()) and !is_endpoint and rng() % 3 == 0)
+    {
+      occupancy.set_occupied(cell.coordinates());
+      map.set_occupied(to_voxel(cell).coordinates());
+    }
+  }
+
+  state_space::Grid<3, 26> grid_state_space{occupancy};
+  state_space::SparseVoxelGrid<26> voxel_state_space{map};
+
+  for (std::uint32_t index = 0; index < occupancy.layout().size(); ++index)
+  {
+    const auto cell = occupancy.layout().state(index);
+    if (occupancy.is_occupied(cell))
+    {
+      continue;
+    }
+
+    std::vector<grid::Voxel> expected;
+    grid_state_space.for_each_child(cell, [&](const grid::Cell<3>& child) { expected.push_back(to_voxel(child)); });
+
+    std::vector<grid::Voxel> children;
+    voxel_state_space.for_each_child(to_voxel(cell), [&children](const grid::Voxel& child) {
+      children.push_back(child);
+    });
+    ASSERT_EQ(children, expected);
+  }
+
+  const auto start = occupancy.layout().state(grid::Coordinates<3>{0, 0, 0});
+  const auto goal = occupancy.layout().state(grid::Coordinates<3>{15, 15, 15});
+
+  ShortestPathPlanner<
+    grid::Cell<3>,
+    int,
+    expansion_queue::MinSorted<grid::Cell<3>, int>,
+    expansion_table::Unordered<grid::Cell<3>, int>>
+    grid_planner;
+  grid::StepMetric<3, int> grid_metric{{0, 10, 14, 17}};
+  ASSERT_EQ(run_plan(grid_planner, grid_metric, grid_state_space, start, goal).first, PlannerCode::GOAL_FOUND);
+
+  ShortestPathPlanner<
+    grid::Voxel,
+    int,
+    expansion_queue::MinSorted<grid::Voxel, int>,
+    expansion_table::VoxelBlocks<int>>
+    voxel_planner;
+  grid::StepMetric<3, int, grid::Voxel> voxel_metric{{0, 10, 14, 17}};
+  ASSERT_EQ(
+    run_plan(voxel_planner, voxel_metric, voxel_state_space, to_voxel(start), to_voxel(goal)).first,
+    PlannerCode::GOAL_FOUND);
+  ASSERT_LE(voxel_planner.expansion_table().block_count(), 27UL);
+
+  const auto& table = voxel_planner.expansion_table();
+  ASSERT_EQ(table.get_total_value(to_voxel(goal)), grid_planner.expansion_table().get_total_value(goal));
+
+  std::vector<grid::Voxel> path(table.path_length(to_voxel(goal)));
+  generate_path(path.begin(), path.size(), to_voxel(goal), table);
+  ASSERT_EQ(path.front(), to_voxel(start));
+
+  int value = 0;
+  for (std::size_t i = 1; i < path.size(); ++i)
+  {
+    ASSERT_FALSE(map.is_occupied(path[i].coordinates()));
+    value += voxel_metric(path[i - 1], path[i]);
+  }
+  ASSERT_EQ(value, table.get_total_value(to_voxel(goal)));
+}
+
+
+TEST(MemoizedStateSpace, ChecksEachEdgeOncePerVersion)
+{
+  // Candidates come from an empty grid; obstacles are only known to the (counted) edge checker
+  grid::Occupancy<2> free_space{grid::Layout<2>{grid::Coordinates<2>{40, 20}}};
+  grid::Occupancy<2> occupancy{free_space.layout()};
+  for (std::int32_t y = 0; y < 15; ++y)
+  {
+    occupancy.set_occupied(grid::Coordinates<2>{20, y});
+  }
+
+  std::size_t checks = 0;
+  const auto checker = [&occupancy, &checks]([[maybe_unused]] const grid::Cell<2>& parent, const grid::Cell<2>& child) {
+    ++checks;
+    return !occupancy.is_occupied(child);
+  };
+
+  EdgeCache<int> cache{1 << 18};
+  state_space::Grid<2, 8> candidates{free_space};
+  state_space::Memoized<state_space::Grid<2, 8>, decltype(checker), int> state_space{candidates, checker, cache};
+  grid::StepMetric<2, int> step_metric{{0, 10, 14}};
+  state_space::MemoizedMetric<grid::StepMetric<2, int>> metric{step_metric, cache};
+
+  const auto start = free_space.layout().state(grid::Coordinates<2>{2, 2});
+  const auto goal = free_space.layout().state(grid::Coordinates<2>{37, 2});
+
+  using PlannerType = ShortestPathPlanner<
+    grid::Cell<2>,
+    int,
+    expansion_queue::MinSorted<grid::Cell<2>, int>,
+    expansion_table::Unordered<grid::Cell<2>, int>>;
+  PlannerType planner;
+
+  ASSERT_EQ(run_plan(planner, metric, state_space, start, goal).first, PlannerCode::GOAL_FOUND);
+  const int value = planner.expansion_table().get_total_value(goal);
+  const std::size_t first_checks = checks;
+  ASSERT_GT(first_checks, 0UL);
+
+  int cached_value;
+  const auto parent = planner.expansion_table().get_parent(goal);
+  ASSERT_TRUE(cache.try_get_value(parent.id(), goal.id(), cached_value));
+  ASSERT_EQ(cached_value, step_metric(parent, goal));
+
+  // Replanning reuses every cached edge check
+  planner.reset();
+  ASSERT_EQ(run_plan(planner, metric, state_space, start, goal).first, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(planner.expansion_table().get_total_value(goal), value);
+  ASSERT_EQ(checks, first_checks);
+
+  // Changing the environment requires invalidation, after which edges are checked again
+  occupancy.set_occupied(grid::Coordinates<2>{20, 15});
+  cache.invalidate();
+  ASSERT_FALSE(cache.try_get_value(parent.id(), goal.id(), cached_value));
+
+  planner.reset();
+  ASSERT_EQ(run_plan(planner, metric, state_space, start, goal).first, PlannerCode::GOAL_FOUND);
+  ASSERT_GT(planner.expansion_table().get_total_value(goal), value);
+  ASSERT_GT(checks, first_checks);
+}
+
+
+
+TEST(MemoizedStateSpace, DropsChecksRacingInvalidation)
+{
+  grid::Occupancy<2> free_space{grid::Layout<2>{grid::Coordinates<2>{4, 4}}};
+  EdgeCache<int> cache{64};
+
+  // Environment changes while the first check is running, as if invalidated by another thread
+  std::size_t checks = 0;
+  const auto checker = [&cache, &checks]([[maybe_unused]] const grid::Cell<2>& parent,
+                                         [[maybe_unused]] const grid::Cell<2>& child) {
+    if (checks++ == 0)
+    {
+      cache.invalidate();
+    }
+    return true;
+  };
+
+  state_space::Grid<2, 8> candidates{free_space};
+  state_space::Memoized<state_space::Grid<2, 8>, decltype(checker), int> state_space{candidates, checker, cache};
+
+  const auto cell = free_space.layout().state(grid::Coordinates<2>{0, 0});
+  std::vector<grid::Cell<2>> children;
+  state_space.for_each_child(cell, [&children](const grid::Cell<2>& child) { children.push_back(child); });
+  ASSERT_EQ(checks, children.size());
+
+  // Only the check which raced the invalidation is repeated
+  bool valid;
+  ASSERT_FALSE(cache.try_get_validity(cell.id(), children.front().id(), valid));
+  state_space.for_each_child(cell, []([[maybe_unused]] const grid::Cell<2>& child) {});
+  ASSERT_EQ(checks, children.size() + 1);
+
+  // Direct writes with an out-of-date version are dropped as well
+  const std::uint32_t version = cache.version();
+  cache.invalidate();
+  cache.set_value(cell.id(), children.front().id(), 10, version);
+  int value;
+  ASSERT_FALSE(cache.try_get_value(cell.id(), children.front().id(), value));
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,118 @@
+
+// C++ Standard Library
+#include <cstdint>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/planner.h>
+#include <mmpl/state_space/lattice.h>
+
+using namespace mmpl;
+
+
+TEST(Lattice, OctilePrimitives)
+{
+  const auto primitives = state_space::make_octile_primitive_set<int>(100.0);
+  ASSERT_EQ(primitives.size(), 24U);
+
+  for (std::uint8_t heading = 0; heading < 8; ++heading)
+  {
+    ASSERT_EQ(primitives.end(heading) - primitives.begin(heading), 3U);
+    for (std::uint32_t i = primitives.begin(heading); i != primitives.end(heading); ++i)
+    {
+      const auto& primitive = primitives[i];
+      ASSERT_EQ(primitive.start_heading, heading);
+      ASSERT_EQ(primitive.swept.back(), primitive.end_offset);
+      ASSERT_GE(primitive.value, 100);
+    }
+  }
+
+  // Straight step along +x sweeps only its end cell
+  const auto& straight = primitives[primitives.begin(0)];
+  ASSERT_EQ(straight.end_offset, (grid::Coordinates<2>{1, 0}));
+  ASSERT_EQ(straight.swept.size(), 1UL);
+  ASSERT_EQ(straight.value, 100);
+
+  // Rotated primitives have equal values
+  for (std::uint8_t heading = 2; heading < 8; ++heading)
+  {
+    for (std::uint32_t k = 0; k < 3; ++k)
+    {
+      ASSERT_EQ(primitives[primitives.begin(heading) + k].value, primitives[primitives.begin(heading % 2) + k].value);
+    }
+  }
+}
+
+
+TEST(Lattice, PlanAvoidsSweptObstacles)
+{
+  // Wall with a single gap; only primitives passing through the gap are feasible
+  grid::Occupancy<2> occupancy{grid::Layout<2>{grid::Coordinates<2>{30, 20}}};
+  for (std::int32_t y = 0; y < 20; ++y)
+  {
+    if (y != 10)
+    {
+      occupancy.set_occupied(grid::Coordinates<2>{15, y});
+    }
+  }
+
+  const auto primitives = state_space::make_octile_primitive_set<int>(100.0);
+  state_space::Lattice<int> state_space{occupancy, primitives};
+  state_space::LatticeMetric<int> metric{primitives};
+
+  const state_space::LatticeState start{occupancy.layout().state(grid::Coordinates<2>{2, 3}), 0};
+  const state_space::LatticeState goal{occupancy.layout().state(grid::Coordinates<2>{27, 16}), 2};
+
+  ShortestPathPlanner<
+    state_space::LatticeState,
+    int,
+    expansion_queue::MinSorted<state_space::LatticeState, int>,
+    expansion_table::Unordered<state_space::LatticeState, int>>
+    planner;
+  ASSERT_EQ(run_plan(planner, metric, state_space, start, goal).first, PlannerCode::GOAL_FOUND);
+
+  const auto& table = planner.expansion_table();
+  std::vector<state_space::LatticeState> path(table.path_length(goal), start);
+  generate_path(path.begin(), path.size(), goal, table);
+  ASSERT_EQ(path.front(), start);
+  ASSERT_EQ(path.back(), goal);
+
+  // Every step follows a primitive from the previous pose, and every swept cell is free
+  int value = 0;
+  bool crossed_gap = false;
+  for (std::size_t i = 1; i < path.size(); ++i)
+  {
+    const std::uint32_t found = primitives.find(path[i - 1], path[i]);
+    ASSERT_NE(found, state_space::LatticeState::NO_PRIMITIVE);
+
+    const auto& primitive = primitives[found];
+    ASSERT_EQ(primitive.start_heading, path[i - 1].heading());
+    for (const auto& offset : primitive.swept)
+    {
+      const grid::Coordinates<2> swept{path[i - 1].cell()[0] + offset[0], path[i - 1].cell()[1] + offset[1]};
+      ASSERT_FALSE(occupancy.is_occupied(swept));
+      crossed_gap |= (swept == grid::Coordinates<2>{15, 10});
+    }
+    // Metric does not depend on primitive index carried by rebuilt states
+    const state_space::LatticeState rebuilt{path[i].cell(), path[i].heading()};
+    ASSERT_EQ(metric(path[i - 1], rebuilt), primitive.value);
+    ASSERT_EQ(metric(path[i - 1], path[i]), primitive.value);
+    value += primitive.value;
+  }
+  ASSERT_EQ(primitives.find(goal, start), state_space::LatticeState::NO_PRIMITIVE);
+  ASSERT_TRUE(crossed_gap);
+  ASSERT_EQ(value, table.get_total_value(goal));
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
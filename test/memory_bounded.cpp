@@ -0,0 +1,177 @@
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/dense_atomic.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/grid/metric.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner/fringe.h>
+#include <mmpl/planner/ida_star.h>
+#include <mmpl/state_space/grid.h>
+
+using namespace mmpl;
+
+namespace mmpl
+{
+
+class TestOctileHeuristic;
+
+template <> struct MetricTraits<TestOctileHeuristic>
+{
+  using StateType = grid::Cell<2>;
+  using ValueType = int;
+};
+
+
+class TestOctileHeuristic : public MetricBase<TestOctileHeuristic>
+{
+private:
+  inline int get_value_impl(const grid::Cell<2>& parent, const grid::Cell<2>& child) const
+  {
+    const int dx = std::abs(parent[0] - child[0]);
+    const int dy = std::abs(parent[1] - child[1]);
+    return 10 * std::max(dx, dy) + 4 * std::min(dx, dy);
+  }
+
+  friend class MetricBase<TestOctileHeuristic>;
+};
+
+}  // namespace mmpl
+
+
+class MemoryBoundedTest : public ::testing::Test
+{
+protected:
+  // Obstacle with a single gap between start and goal
+  MemoryBoundedTest() :
+      occupancy_{grid::Layout<2>{grid::Coordinates<2>{12, 10}}},
+      state_space_{occupancy_},
+      metric_{{0, 10, 14}},
+      start_{occupancy_.layout().state(grid::Coordinates<2>{1, 6})},
+      goal_{occupancy_.layout().state(grid::Coordinates<2>{10, 7})}
+  {
+    for (std::int32_t y = 0; y < 9; ++y)
+    {
+      occupancy_.set_occupied(grid::Coordinates<2>{6, y});
+    }
+  }
+
+  int reference_value()
+  {
+    ShortestPathPlanner<
+      grid::Cell<2>,
+      int,
+      expansion_queue::MinSorted<grid::Cell<2>, int>,
+      expansion_table::Unordered<grid::Cell<2>, int>>
+      planner;
+    const auto [code, iterations] = run_plan(planner, metric_, state_space_, start_, goal_);
+    EXPECT_EQ(code, PlannerCode::GOAL_FOUND);
+    return planner.expansion_table().get_total_value(goal_);
+  }
+
+  int path_value(const std::vector<grid::Cell<2>>& path)
+  {
+    int value = 0;
+    for (std::size_t i = 1; i < path.size(); ++i)
+    {
+      value += metric_(path[i - 1], path[i]);
+    }
+    return value;
+  }
+
+  grid::Occupancy<2> occupancy_;
+
+  state_space::Grid<2, 8> state_space_;
+
+  grid::StepMetric<2, int> metric_;
+
+  TestOctileHeuristic heuristic_;
+
+  grid::Cell<2> start_;
+
+  grid::Cell<2> goal_;
+};
+
+
+TEST_F(MemoryBoundedTest, IDAStarFindsOptimalPath)
+{
+  SingleGoalTerminationCriteria<grid::Cell<2>> criteria{goal_};
+
+  planner::IDAStar<grid::Cell<2>, int> planner{64};
+  const auto [code, iterations] = planner.run(metric_, heuristic_, state_space_, criteria, start_, goal_);
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+
+  ASSERT_EQ(planner.path().front(), start_);
+  ASSERT_EQ(planner.path().back(), goal_);
+  ASSERT_EQ(planner.path_value(), reference_value());
+  ASSERT_EQ(path_value(planner.path()), planner.path_value());
+}
+
+
+TEST_F(MemoryBoundedTest, FringeFindsOptimalPath)
+{
+  SingleGoalTerminationCriteria<grid::Cell<2>> criteria{goal_};
+
+  using TableType = expansion_table::DenseAtomic<grid::Cell<2>, int, grid::Layout<2>>;
+  planner::Fringe<grid::Cell<2>, int, TableType, grid::Layout<2>> planner{
+    occupancy_.layout(), TableType{occupancy_.layout()}};
+
+  for (int repeat = 0; repeat < 2; ++repeat)
+  {
+    const auto [code, iterations] = planner.run(metric_, heuristic_, state_space_, criteria, start_, goal_);
+    ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+    ASSERT_EQ(planner.terminal(), goal_);
+    ASSERT_EQ(planner.expansion_table().get_total_value(goal_), reference_value());
+
+    std::vector<grid::Cell<2>> path(planner.expansion_table().path_length(goal_));
+    generate_path(path.begin(), path.size(), goal_, planner.expansion_table());
+    ASSERT_EQ(path.front(), start_);
+    ASSERT_EQ(path_value(path), reference_value());
+  }
+}
+
+
+TEST_F(MemoryBoundedTest, Infeasible)
+{
+  // Enclose the start state
+  for (std::int32_t y = 5; y <= 7; ++y)
+  {
+    for (std::int32_t x = 0; x <= 2; ++x)
+    {
+      if (x != start_[0] or y != start_[1])
+      {
+        occupancy_.set_occupied(grid::Coordinates<2>{x, y});
+      }
+    }
+  }
+  SingleGoalTerminationCriteria<grid::Cell<2>> criteria{goal_};
+
+  planner::IDAStar<grid::Cell<2>, int> ida_star_planner{64};
+  ASSERT_EQ(
+    ida_star_planner.run(metric_, heuristic_, state_space_, criteria, start_, goal_).first, PlannerCode::INFEASIBLE);
+
+  using TableType = expansion_table::DenseAtomic<grid::Cell<2>, int, grid::Layout<2>>;
+  planner::Fringe<grid::Cell<2>, int, TableType, grid::Layout<2>> fringe_planner{
+    occupancy_.layout(), TableType{occupancy_.layout()}};
+  SingleGoalTerminationCriteria<grid::Cell<2>> reverse_criteria{start_};
+  ASSERT_EQ(
+    fringe_planner.run(metric_, heuristic_, state_space_, reverse_criteria, goal_, start_).first,
+    PlannerCode::INFEASIBLE);
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,619 @@
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/interned.h>
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_queue/quaternary_heap.h>
+#include <mmpl/expansion_table/interned.h>
+#include <mmpl/expansion_table/source_labeled.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner/focal_search.h>
+#include <mmpl/planner/lazy_shortest_path.h>
+#include <mmpl/state_pool.h>
+
+using namespace mmpl;
+
+namespace mmpl
+{
+
+class TestCell;
+class TestOctileMetric;
+class TestClearanceMetric;
+class TestOctileHeuristicMetric;
+class TestGridStateSpace;
+class TestBatchedGridStateSpace;
+
+template <> struct StateTraits<TestCell>
+{
+  using IDType = std::size_t;
+};
+
+
+template <> struct MetricTraits<TestOctileMetric>
+{
+  using StateType = TestCell;
+  using ValueType = int;
+};
+
+
+template <> struct MetricTraits<TestClearanceMetric>
+{
+  using StateType = TestCell;
+  using ValueType = int;
+};
+
+
+template <> struct MetricTraits<TestOctileHeuristicMetric>
+{
+  using StateType = TestCell;
+  using ValueType = HeuristicValue<int>;
+};
+
+
+template <> struct StateSpaceTraits<TestGridStateSpace>
+{
+  using StateType = TestCell;
+};
+
+
+template <> struct StateSpaceTraits<TestBatchedGridStateSpace>
+{
+  using StateType = TestCell;
+  static constexpr std::size_t child_block_size = 8;
+};
+
+
+class TestCell : public StateBase<TestCell>
+{
+public:
+  TestCell() = default;
+
+  TestCell(int _x, int _y) : x{_x}, y{_y} {}
+
+  int x = 0;
+  int y = 0;
+
+private:
+  inline std::size_t id_impl() const { return static_cast<std::size_t>(x) * 1000UL + static_cast<std::size_t>(y); }
+
+  inline bool equals_impl(const TestCell& other) const { return x == other.x and y == other.y; }
+
+  friend class StateBase<TestCell>;
+};
+
+
+class TestOctileMetric : public MetricBase<TestOctileMetric>
+{
+private:
+  inline int get_value_impl(const TestCell& parent, const TestCell& child) const
+  {
+    return (parent.x == child.x or parent.y == child.y) ? 10 : 14;
+  }
+
+  inline void get_values_impl(const TestCell& parent, const TestCell* children, int* values, std::size_t count) const
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      values[i] = 10 + 4 * ((parent.x != children[i].x) & (parent.y != children[i].y));
+    }
+  }
+
+  friend class MetricBase<TestOctileMetric>;
+};
+
+
+/**
+ * @brief Octile metric which triples the value of moves into cells next to the wall, and counts its evaluations
+ */
+class TestClearanceMetric : public MetricBase<TestClearanceMetric>
+{
+public:
+  std::size_t evaluations = 0;
+
+private:
+  inline int get_value_impl(const TestCell& parent, const TestCell& child)
+  {
+    ++evaluations;
+    const int octile = (parent.x == child.x or parent.y == child.y) ? 10 : 14;
+    return (std::abs(child.x - 5) == 1) ? 3 * octile : octile;
+  }
+
+  friend class MetricBase<TestClearanceMetric>;
+};
+
+
+/**
+ * @brief Octile metric with an octile distance-to-goal heuristic, for A* searches
+ */
+class TestOctileHeuristicMetric : public MetricBase<TestOctileHeuristicMetric>
+{
+public:
+  explicit TestOctileHeuristicMetric(const TestCell& goal) : goal_{goal} {}
+
+private:
+  inline int heuristic(const TestCell& cell) const
+  {
+    const int dx = std::abs(cell.x - goal_.x);
+    const int dy = std::abs(cell.y - goal_.y);
+    return 10 * std::max(dx, dy) + 4 * std::min(dx, dy);
+  }
+
+  inline HeuristicValue<int> get_value_impl(const TestCell& parent, const TestCell& child) const
+  {
+    const int value = (parent.x == child.x or parent.y == child.y) ? 10 : 14;
+    return HeuristicValue<int>{value, heuristic(child) - heuristic(parent)};
+  }
+
+  TestCell goal_;
+
+  friend class MetricBase<TestOctileHeuristicMetric>;
+};
+
+
+static constexpr int kExtent = 12;
+
+static constexpr int kOffsets[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+
+
+inline bool is_free(const int x, const int y)
+{
+  // Wall along x = 5 with a gap at y = 10
+  return x >= 0 and y >= 0 and x < kExtent and y < kExtent and (x != 5 or y == 10);
+}
+
+
+class TestGridStateSpace : public StateSpaceBase<TestGridStateSpace>
+{
+private:
+  template <typename UnaryChildFn> inline bool for_each_child_impl(const TestCell& parent, UnaryChildFn&& child_fn)
+  {
+    for (const auto& offset : kOffsets)
+    {
+      if (is_free(parent.x + offset[0], parent.y + offset[1]))
+      {
+        child_fn(TestCell{parent.x + offset[0], parent.y + offset[1]});
+      }
+    }
+    return true;
+  }
+
+  friend class StateSpaceBase<TestGridStateSpace>;
+};
+
+
+class TestBatchedGridStateSpace : public StateSpaceBase<TestBatchedGridStateSpace>
+{
+private:
+  template <typename UnaryBlockFn>
+  inline bool for_each_child_block_impl(const TestCell& parent, UnaryBlockFn&& block_fn)
+  {
+    ChildBlock<TestCell, 8> block;
+    for (const auto& offset : kOffsets)
+    {
+      if (is_free(parent.x + offset[0], parent.y + offset[1]))
+      {
+        block.states[block.size++] = TestCell{parent.x + offset[0], parent.y + offset[1]};
+      }
+    }
+    block_fn(block);
+    return true;
+  }
+
+  friend class StateSpaceBase<TestBatchedGridStateSpace>;
+};
+
+}  // namespace mmpl
+
+
+using TestPlanner = ShortestPathPlanner<
+  TestCell,
+  int,
+  expansion_queue::MinSorted<TestCell, int>,
+  expansion_table::Unordered<TestCell, int>>;
+
+
+/**
+ * @brief Relaxes a state after its subtree was expanded, and checks the path through the rerouted subtree
+ */
+template <typename ExpansionTableT> void check_path_after_relax(ExpansionTableBase<ExpansionTableT>& table)
+{
+  const TestCell root{0, 0}, a{1, 0}, b{2, 0}, c{3, 0}, d{0, 1};
+  table.reset();
+  table.expand(root, root, 0);
+  table.expand(root, a, 10);
+  table.expand(a, b, 11);
+  table.expand(b, c, 12);
+
+  // Reroute 'a' through 'd'; every state below 'a' is now one link deeper
+  ASSERT_TRUE(table.relax(root, d, 1));
+  ASSERT_TRUE(table.relax(d, a, 2));
+
+  ASSERT_EQ(table.path_length(c), 5UL);
+  std::vector<TestCell> path(table.path_length(c), c);
+  ASSERT_EQ(generate_path(path.begin(), path.end(), c, table), path.end());
+  ASSERT_EQ(path, (std::vector<TestCell>{root, d, a, b, c}));
+
+  std::vector<TestCell> known_length_path(5, c);
+  ASSERT_EQ(generate_path(known_length_path.begin(), 5UL, c, table), known_length_path.end());
+  ASSERT_EQ(known_length_path, path);
+}
+
+
+TEST(ExpansionTable, PathLengthAfterRelax)
+{
+  expansion_table::Unordered<TestCell, int> table;
+  check_path_after_relax(table);
+
+  StatePool<TestCell> pool;
+  expansion_table::Interned<TestCell, int> interned_table{pool};
+  check_path_after_relax(interned_table);
+}
+
+
+TEST(ShortestPathPlanner, ShortestPathAroundWall)
+{
+  TestPlanner planner;
+  TestOctileMetric metric;
+  TestGridStateSpace state_space;
+
+  const auto [code, iterations] = run_plan(planner, metric, state_space, TestCell{0, 0}, TestCell{10, 0});
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+
+  // (0, 0) --> (5, 10) gap --> (10, 0), each leg being 5 diagonal and 5 straight moves
+  ASSERT_EQ(planner.expansion_table().get_total_value(TestCell{10, 0}), 2 * (14 * 5 + 10 * 5));
+}
+
+
+TEST(ShortestPathPlanner, BatchedMatchesUnbatched)
+{
+  TestPlanner planner;
+  TestPlanner batched_planner;
+  TestOctileMetric metric;
+  TestGridStateSpace state_space;
+  TestBatchedGridStateSpace batched_state_space;
+
+  const auto [code, iterations] = run_plan(planner, metric, state_space, TestCell{0, 0}, TestCell{10, 0});
+  const auto [batched_code, batched_iterations] =
+    run_plan(batched_planner, metric, batched_state_space, TestCell{0, 0}, TestCell{10, 0});
+
+  ASSERT_EQ(code.value, batched_code.value);
+  ASSERT_EQ(iterations, batched_iterations);
+
+  for (int x = 0; x < kExtent; ++x)
+  {
+    for (int y = 0; y < kExtent; ++y)
+    {
+      ASSERT_EQ(
+        planner.expansion_table().try_get_total_value(TestCell{x, y}),
+        batched_planner.expansion_table().try_get_total_value(TestCell{x, y}));
+    }
+  }
+}
+
+
+TEST(ShortestPathPlanner, MultiSourceLabelsNearestSource)
+{
+  // Duplicate sources keep the label of their first occurrence, and do not shift later labels
+  const std::vector<TestCell> sources{TestCell{0, 0}, TestCell{11, 0}, TestCell{0, 0}, TestCell{6, 11}};
+
+  TestOctileMetric metric;
+  TestGridStateSpace state_space;
+
+  ShortestPathPlanner<
+    TestCell,
+    int,
+    expansion_queue::MinSorted<TestCell, int>,
+    expansion_table::SourceLabeled<expansion_table::Unordered<TestCell, int>>>
+    planner;
+
+  const auto [code, iterations] = run_multi_source(planner, metric, state_space, sources.begin(), sources.end());
+  ASSERT_EQ(code, PlannerCode::INFEASIBLE);
+  ASSERT_EQ(planner.expansion_table().source_count(), sources.size());
+  ASSERT_EQ(planner.expansion_table().source(TestCell{6, 11}), 3U);
+
+  // Reference values from one search per source
+  std::vector<TestPlanner> single_source_planners(sources.size());
+  for (std::size_t s = 0; s < sources.size(); ++s)
+  {
+    run_multi_source(single_source_planners[s], metric, state_space, sources.begin() + s, sources.begin() + s + 1);
+  }
+
+  for (int x = 0; x < kExtent; ++x)
+  {
+    for (int y = 0; y < kExtent; ++y)
+    {
+      if (!is_free(x, y))
+      {
+        continue;
+      }
+
+      std::vector<int> values;
+      for (const auto& single_source_planner : single_source_planners)
+      {
+        values.push_back(single_source_planner.expansion_table().get_total_value(TestCell{x, y}));
+      }
+
+      const auto label = planner.expansion_table().source(TestCell{x, y});
+      ASSERT_LT(label, sources.size());
+      ASSERT_NE(label, 2U);
+      ASSERT_EQ(planner.expansion_table().get_total_value(TestCell{x, y}), values[label]);
+      ASSERT_EQ(values[label], *std::min_element(values.begin(), values.end()));
+    }
+  }
+}
+
+
+TEST(ShortestPathPlanner, InternedMatchesUnordered)
+{
+  TestPlanner planner;
+  TestOctileMetric metric;
+  TestGridStateSpace state_space;
+  ASSERT_EQ(run_plan(planner, metric, state_space, TestCell{0, 0}, TestCell{10, 0}).first, PlannerCode::GOAL_FOUND);
+
+  StatePool<TestCell> pool;
+  ShortestPathPlanner<
+    TestCell,
+    int,
+    expansion_queue::Interned<TestCell, int>,
+    expansion_table::Interned<TestCell, int>>
+    interned_planner{expansion_queue::Interned<TestCell, int>{pool}, expansion_table::Interned<TestCell, int>{pool}};
+
+  for (int repeat = 0; repeat < 2; ++repeat)
+  {
+    interned_planner.reset();
+    ASSERT_EQ(
+      run_plan(interned_planner, metric, state_space, TestCell{0, 0}, TestCell{10, 0}).first,
+      PlannerCode::GOAL_FOUND);
+
+    for (int x = 0; x < kExtent; ++x)
+    {
+      for (int y = 0; y < kExtent; ++y)
+      {
+        ASSERT_EQ(
+          interned_planner.expansion_table().try_get_total_value(TestCell{x, y}),
+          planner.expansion_table().try_get_total_value(TestCell{x, y}));
+      }
+    }
+
+    const auto& table = interned_planner.expansion_table();
+    ASSERT_EQ(table.path_length(TestCell{10, 0}), planner.expansion_table().path_length(TestCell{10, 0}));
+    for (TestCell cell{10, 0}; !(cell == TestCell{0, 0}); cell = table.get_parent(cell))
+    {
+      const TestCell parent = table.get_parent(cell);
+      ASSERT_EQ(table.get_total_value(parent) + metric(parent, cell), table.get_total_value(cell));
+    }
+  }
+
+  // Every state is interned once, and handles survive resets
+  ASSERT_LE(pool.size(), static_cast<std::size_t>(kExtent * kExtent));
+  ASSERT_EQ(pool.state(pool.find(TestCell{10, 0})), (TestCell{10, 0}));
+  ASSERT_EQ(pool.find(TestCell{-1, -1}), NO_STATE_HANDLE);
+}
+
+
+TEST(QuaternaryHeap, MatchesMinSorted)
+{
+  std::mt19937 rng{5};
+  expansion_queue::MinSorted<TestCell, int> queue;
+  expansion_queue::QuaternaryHeap<TestCell, int> heap;
+
+  // Interleave pushes and pops, so that freed payload slots are reused
+  for (int i = 0; i < 2000; ++i)
+  {
+    if (rng() % 3 == 0 and !queue.empty())
+    {
+      ASSERT_FALSE(heap.empty());
+      ASSERT_EQ(queue.next().value, heap.next().value);
+    }
+    else
+    {
+      const int value = static_cast<int>(rng() % 100);
+      queue.enqueue(TestCell{i, 0}, value);
+      heap.enqueue(TestCell{i, 0}, value);
+    }
+  }
+
+  std::vector<bool> popped(2000, false);
+  while (!queue.empty())
+  {
+    const auto next = heap.next();
+    ASSERT_EQ(queue.next().value, next.value);
+    ASSERT_FALSE(popped[next.state.x]);
+    popped[next.state.x] = true;
+  }
+  ASSERT_TRUE(heap.empty());
+
+  ShortestPathPlanner<
+    TestCell,
+    int,
+    expansion_queue::QuaternaryHeap<TestCell, int>,
+    expansion_table::Unordered<TestCell, int>>
+    planner;
+  TestOctileMetric metric;
+  TestGridStateSpace state_space;
+  ASSERT_EQ(run_plan(planner, metric, state_space, TestCell{0, 0}, TestCell{10, 0}).first, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(planner.expansion_table().get_total_value(TestCell{10, 0}), 2 * (14 * 5 + 10 * 5));
+}
+
+
+template <typename ExpansionQueueT> std::pair<int, std::size_t> plan_octile_a_star(ExpansionQueueT&& queue)
+{
+  using ValueType = HeuristicValue<int>;
+  ShortestPathPlanner<TestCell, ValueType, ExpansionQueueT, expansion_table::Unordered<TestCell, ValueType>> planner{
+    std::move(queue)};
+  TestOctileHeuristicMetric metric{TestCell{4, 11}};
+  TestGridStateSpace state_space;
+
+  const auto [code, iterations] = run_plan(planner, metric, state_space, TestCell{0, 0}, TestCell{4, 11});
+  EXPECT_EQ(code, PlannerCode::GOAL_FOUND);
+  return std::make_pair(planner.expansion_table().get_total_value(TestCell{4, 11}).g(), iterations);
+}
+
+
+TEST(TieBreaking, HigherGExpandsFewerStates)
+{
+  using ValueType = HeuristicValue<int>;
+  using AllocatorType = std::allocator<StateValue<TestCell, ValueType>>;
+  namespace tie_breaking = expansion_queue::tie_breaking;
+
+  const auto [value, iterations] = plan_octile_a_star(expansion_queue::MinSorted<TestCell, ValueType>{});
+  const auto [higher_g_value, higher_g_iterations] =
+    plan_octile_a_star(expansion_queue::MinSorted<TestCell, ValueType, AllocatorType, tie_breaking::HigherG>{});
+  const auto [heap_value, heap_iterations] =
+    plan_octile_a_star(expansion_queue::QuaternaryHeap<TestCell, ValueType, tie_breaking::HigherG>{});
+  const auto [lifo_value, lifo_iterations] =
+    plan_octile_a_star(expansion_queue::QuaternaryHeap<TestCell, ValueType, tie_breaking::Lifo>{});
+
+  // Goal lies 4 diagonal and 7 straight moves away, past a wide plateau of equal f-values
+  ASSERT_EQ(value, 14 * 4 + 10 * 7);
+  ASSERT_EQ(higher_g_value, value);
+  ASSERT_EQ(heap_value, value);
+  ASSERT_EQ(lifo_value, value);
+  ASSERT_LT(higher_g_iterations, iterations);
+  ASSERT_LT(heap_iterations, iterations);
+  ASSERT_LT(lifo_iterations, iterations);
+}
+
+
+template <typename ExpansionQueueT> void check_user_key_order(ExpansionQueueT&& queue)
+{
+  // Enqueue cells with two distinct values in shuffled order
+  std::mt19937 rng{13};
+  std::vector<TestCell> cells;
+  for (int x = 0; x < 50; ++x)
+  {
+    cells.push_back(TestCell{x, x % 2});
+  }
+  std::shuffle(cells.begin(), cells.end(), rng);
+  for (const auto& cell : cells)
+  {
+    queue.enqueue(cell, cell.y);
+  }
+
+  // Equal values are dequeued in order of decreasing x, as given by the user key
+  for (int y = 0; y < 2; ++y)
+  {
+    for (int x = 48 + y; x >= 0; x -= 2)
+    {
+      ASSERT_FALSE(queue.empty());
+      const auto next = queue.next();
+      ASSERT_EQ(next.value, y);
+      ASSERT_EQ(next.state, (TestCell{x, y}));
+    }
+  }
+  ASSERT_TRUE(queue.empty());
+}
+
+
+TEST(TieBreaking, UserKeyOrdersEqualValues)
+{
+  const auto larger_x_first = [](const TestCell& cell, int) { return -cell.x; };
+  using UserKeyType = expansion_queue::tie_breaking::UserKey<decltype(larger_x_first)>;
+  using AllocatorType = std::allocator<StateValue<TestCell, int>>;
+
+  check_user_key_order(
+    expansion_queue::MinSorted<TestCell, int, AllocatorType, UserKeyType>{0, UserKeyType{larger_x_first}});
+  check_user_key_order(expansion_queue::QuaternaryHeap<TestCell, int, UserKeyType>{0, UserKeyType{larger_x_first}});
+}
+
+
+TEST(FocalSearch, WithinSuboptimalityBound)
+{
+  TestOctileMetric metric;
+  TestGridStateSpace state_space;
+  const TestCell start{0, 0};
+  const TestCell goal{4, 11};
+
+  const auto heuristic = [&goal](const TestCell& cell) {
+    const int dx = std::abs(cell.x - goal.x);
+    const int dy = std::abs(cell.y - goal.y);
+    return 10 * std::max(dx, dy) + 4 * std::min(dx, dy);
+  };
+  const auto steps_to_go = [&goal](const TestCell& cell, int) {
+    return std::max(std::abs(cell.x - goal.x), std::abs(cell.y - goal.y));
+  };
+
+  using PlannerType = planner::
+    FocalSearch<TestCell, int, decltype(heuristic), decltype(steps_to_go), expansion_table::Unordered<TestCell, int>>;
+
+  PlannerType optimal_planner{1.0, heuristic, steps_to_go};
+  const auto [optimal_code, optimal_iterations] = run_plan(optimal_planner, metric, state_space, start, goal);
+  ASSERT_EQ(optimal_code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(optimal_planner.expansion_table().get_total_value(goal), 14 * 4 + 10 * 7);
+
+  PlannerType focal_planner{2.0, heuristic, steps_to_go};
+  const auto [focal_code, focal_iterations] = run_plan(focal_planner, metric, state_space, start, goal);
+  ASSERT_EQ(focal_code, PlannerCode::GOAL_FOUND);
+  ASSERT_LE(focal_planner.expansion_table().get_total_value(goal), 2 * (14 * 4 + 10 * 7));
+  ASSERT_LE(focal_iterations, optimal_iterations);
+
+  // Steps-to-go ordering within FOCAL heads straight for the goal, unlike plain A* on the plateau of equal f-values
+  const auto [a_star_value, a_star_iterations] =
+    plan_octile_a_star(expansion_queue::MinSorted<TestCell, HeuristicValue<int>>{});
+  ASSERT_EQ(a_star_value, optimal_planner.expansion_table().get_total_value(goal));
+  ASSERT_LT(focal_iterations, a_star_iterations);
+
+  // FOCAL only ever holds entries of OPEN
+  ASSERT_LE(focal_planner.expansion_queue().focal_size(), focal_planner.expansion_queue().open_size());
+}
+
+
+TEST(LazyShortestPath, MatchesEagerWithFewerEvaluations)
+{
+  TestOctileMetric estimate;
+  TestGridStateSpace state_space;
+
+  TestClearanceMetric eager_metric;
+  TestPlanner eager_planner;
+  ASSERT_EQ(
+    run_plan(eager_planner, eager_metric, state_space, TestCell{0, 0}, TestCell{10, 0}).first,
+    PlannerCode::GOAL_FOUND);
+
+  TestClearanceMetric lazy_metric;
+  planner::LazyShortestPath<
+    TestCell,
+    int,
+    TestOctileMetric,
+    expansion_queue::MinSorted<TestCell, int>,
+    expansion_table::Unordered<TestCell, int>>
+    lazy_planner{estimate};
+  ASSERT_EQ(
+    run_plan(lazy_planner, lazy_metric, state_space, TestCell{0, 0}, TestCell{10, 0}).first,
+    PlannerCode::GOAL_FOUND);
+
+  ASSERT_EQ(
+    lazy_planner.expansion_table().get_total_value(TestCell{10, 0}),
+    eager_planner.expansion_table().get_total_value(TestCell{10, 0}));
+  ASSERT_EQ(lazy_planner.evaluations(), lazy_metric.evaluations);
+  ASSERT_LT(lazy_metric.evaluations, eager_metric.evaluations);
+
+  // Recorded path only holds evaluated edges
+  const auto& table = lazy_planner.expansion_table();
+  for (TestCell cell{10, 0}; !(cell == TestCell{0, 0}); cell = table.get_parent(cell))
+  {
+    const TestCell parent = table.get_parent(cell);
+    ASSERT_EQ(table.get_total_value(parent) + TestClearanceMetric{}(parent, cell), table.get_total_value(cell));
+  }
+
+  lazy_planner.reset();
+  ASSERT_EQ(lazy_planner.pending(), 0UL);
+  ASSERT_EQ(lazy_planner.evaluations(), 0UL);
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,217 @@
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/planner.h>
+#include <mmpl/sampling/configuration.h>
+#include <mmpl/sampling/kd_tree.h>
+#include <mmpl/sampling/prm.h>
+#include <mmpl/sampling/rrt_star.h>
+#include <mmpl/state_space/csr.h>
+
+using namespace mmpl;
+using namespace mmpl::sampling;
+
+
+/**
+ * @brief Unit square with a wall along x = 0.5, passable above y = 0.8
+ */
+inline bool is_free(const Point<2>& point)
+{
+  return point[0] >= 0.0 and point[0] <= 1.0 and point[1] >= 0.0 and point[1] <= 1.0 and
+    (std::abs(point[0] - 0.5) > 0.05 or point[1] > 0.8);
+}
+
+
+inline bool is_free_edge(const Point<2>& from, const Point<2>& to)
+{
+  const int steps = static_cast<int>(std::ceil(std::sqrt(squared_distance(from, to)) / 0.005)) + 1;
+  for (int i = 0; i <= steps; ++i)
+  {
+    const double t = static_cast<double>(i) / steps;
+    if (!is_free(Point<2>{from[0] + t * (to[0] - from[0]), from[1] + t * (to[1] - from[1])}))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+inline Point<2> sample_unit_square(std::mt19937_64& rng)
+{
+  std::uniform_real_distribution<double> dist{0.0, 1.0};
+  const double x = dist(rng);
+  return Point<2>{x, dist(rng)};
+}
+
+
+/// Start and goal on either side of the wall
+static const Point<2> kStart{0.1, 0.1};
+static const Point<2> kGoal{0.9, 0.1};
+
+
+/**
+ * @brief Returns value of shortest path from start to goal, over the wall corners
+ */
+inline double shortest_path_value()
+{
+  return std::sqrt(squared_distance(kStart, Point<2>{0.45, 0.8})) + 0.1 +
+    std::sqrt(squared_distance(Point<2>{0.55, 0.8}, kGoal));
+}
+
+
+TEST(KdTree, MatchesBruteForce)
+{
+  std::mt19937_64 rng{3};
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+
+  std::vector<Point<3>> points;
+  for (int i = 0; i < 1500; ++i)
+  {
+    points.push_back(Point<3>{dist(rng), dist(rng), dist(rng)});
+  }
+
+  // Coincident points must not break splitting
+  for (int i = 0; i < 40; ++i)
+  {
+    points.push_back(points[7]);
+  }
+
+  // Bulk-build first half, then insert the rest one at a time
+  KdTree<3> tree;
+  const std::size_t half = points.size() / 2;
+  tree.build(points.begin(), points.begin() + half);
+  for (std::size_t i = half; i < points.size(); ++i)
+  {
+    ASSERT_EQ(tree.insert(points[i]), i);
+  }
+
+  std::vector<Point<3>> queries;
+  for (int i = 0; i < 200; ++i)
+  {
+    queries.push_back(Point<3>{dist(rng), dist(rng), dist(rng)});
+  }
+
+  static constexpr std::size_t kNeighbors = 8;
+  std::vector<std::uint32_t> nearest(queries.size());
+  std::vector<std::uint32_t> nearest_k(queries.size() * kNeighbors);
+  tree.nearest(queries.data(), nearest.data(), queries.size());
+  tree.nearest_k(queries.data(), queries.size(), kNeighbors, nearest_k.data());
+
+  std::vector<std::uint32_t> within;
+  for (std::size_t q = 0; q < queries.size(); ++q)
+  {
+    std::vector<double> distances;
+    for (const auto& point : points)
+    {
+      distances.push_back(squared_distance(queries[q], point));
+    }
+    std::vector<double> sorted{distances};
+    std::sort(sorted.begin(), sorted.end());
+
+    ASSERT_EQ(distances[nearest[q]], sorted.front());
+    for (std::size_t j = 0; j < kNeighbors; ++j)
+    {
+      ASSERT_EQ(distances[nearest_k[q * kNeighbors + j]], sorted[j]);
+    }
+
+    const double radius = 0.3;
+    tree.within_radius(queries[q], radius, within);
+    ASSERT_EQ(
+      within.size(),
+      static_cast<std::size_t>(std::count_if(
+        distances.begin(), distances.end(), [radius](const double d2) { return d2 <= radius * radius; })));
+  }
+}
+
+
+TEST(Prm, RoadmapSearchAroundWall)
+{
+  EuclideanMetric<2> metric;
+  Prm<2, EuclideanMetric<2>, decltype(&is_free), decltype(&is_free_edge)> prm{metric, is_free, is_free_edge, 4};
+  prm.build(sample_unit_square, 2000, 10, 5);
+  ASSERT_GT(prm.size(), 1800UL);
+
+  const std::uint32_t start = prm.connect(kStart, 10);
+  const std::uint32_t goal = prm.connect(kGoal, 10);
+  ASSERT_NE(start, KdTree<2>::NO_INDEX);
+  ASSERT_NE(goal, KdTree<2>::NO_INDEX);
+
+  // Roadmap is searched with the usual planner machinery
+  using namespace mmpl::state_space;
+  CsrStateSpace<double> state_space{prm.graph()};
+  CsrMetric<double> roadmap_metric{prm.graph()};
+  ShortestPathPlanner<
+    CsrVertex,
+    double,
+    expansion_queue::MinSorted<CsrVertex, double>,
+    expansion_table::Unordered<CsrVertex, double>>
+    planner;
+
+  const auto [code, iterations] = run_plan(planner, roadmap_metric, state_space, CsrVertex{start}, CsrVertex{goal});
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+
+  const double value = planner.expansion_table().get_total_value(CsrVertex{goal});
+  ASSERT_GE(value + 1e-9, shortest_path_value() - 0.1);
+  ASSERT_LT(value, 1.5 * shortest_path_value());
+
+  std::vector<CsrVertex> path;
+  generate_reverse_path(std::back_inserter(path), CsrVertex{goal}, planner.expansion_table());
+  for (std::size_t i = 1; i < path.size(); ++i)
+  {
+    ASSERT_TRUE(is_free_edge(prm.index().point(path[i - 1].vertex()), prm.index().point(path[i].vertex())));
+  }
+}
+
+
+TEST(RrtStar, PathValueImprovesWithIterations)
+{
+  EuclideanMetric<2> metric;
+  RrtStar<2, EuclideanMetric<2>, decltype(&is_free), decltype(&is_free_edge)> rrt_star{
+    metric, is_free, is_free_edge, 0.1, 1.5};
+  rrt_star.reset(kStart);
+
+  std::mt19937_64 rng{9};
+  rrt_star.grow(sample_unit_square, rng, 3000);
+
+  const std::uint32_t first_goal = rrt_star.best_within(kGoal, 0.05);
+  ASSERT_NE(first_goal, decltype(rrt_star)::NO_INDEX);
+  const double first_value = rrt_star.value(first_goal);
+  ASSERT_GE(first_value, shortest_path_value() - 0.1);
+
+  rrt_star.grow(sample_unit_square, rng, 6000);
+  const std::uint32_t goal = rrt_star.best_within(kGoal, 0.05);
+  ASSERT_LE(rrt_star.value(goal), first_value);
+
+  // Tree path values match edge values along valid edges
+  std::vector<Configuration<2>> path;
+  rrt_star.path(goal, std::back_inserter(path));
+  ASSERT_EQ(path.front().index(), 0U);
+
+  double value = 0.0;
+  for (std::size_t i = 1; i < path.size(); ++i)
+  {
+    ASSERT_TRUE(is_free_edge(path[i - 1].point(), path[i].point()));
+    value += metric(path[i - 1], path[i]);
+  }
+  ASSERT_NEAR(value, rrt_star.value(goal), 1e-9);
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,388 @@
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/grid/metric.h>
+#include <mmpl/grid/occupancy.h>
+#include <mmpl/planner.h>
+#include <mmpl/planner/conflict_based_search.h>
+#include <mmpl/state_space/grid.h>
+#include <mmpl/state_space/space_time.h>
+
+using namespace mmpl;
+
+using SpaceTimeCell = state_space::SpaceTimeState<grid::Cell<2>>;
+
+class TestRandomStepMetric;
+
+namespace mmpl
+{
+
+template <> struct MetricTraits<TestRandomStepMetric>
+{
+  using StateType = state_space::SpaceTimeState<grid::Cell<2>>;
+  using ValueType = int;
+};
+
+}  // namespace mmpl
+
+
+/**
+ * @brief Values each move or wait by a pseudo-random weight of the cell and time step it arrives at
+ *
+ *        Distinct space-time paths almost never tie in value, so searches which agree on values agree on paths
+ */
+class TestRandomStepMetric : public MetricBase<TestRandomStepMetric>
+{
+public:
+  explicit TestRandomStepMetric(const std::uint64_t seed) : seed_{seed} {}
+
+private:
+  inline int get_value_impl(
+    [[maybe_unused]] const state_space::SpaceTimeState<grid::Cell<2>>& parent,
+    const state_space::SpaceTimeState<grid::Cell<2>>& child) const
+  {
+    std::uint64_t key = seed_ ^ ((static_cast<std::uint64_t>(child.state().index()) << 32) | child.time());
+    key = (key ^ (key >> 31)) * 0x7fb5d329728ea185ULL;
+    key = (key ^ (key >> 27)) * 0x81dadef4bc2dd44dULL;
+    return 1 + static_cast<int>((key ^ (key >> 33)) % (1 << 20));
+  }
+
+  /// Weight seed
+  std::uint64_t seed_;
+
+  friend class MetricBase<TestRandomStepMetric>;
+};
+
+
+using SpaceTimePlanner = ShortestPathPlanner<
+  SpaceTimeCell,
+  int,
+  expansion_queue::MinSorted<SpaceTimeCell, int>,
+  expansion_table::Unordered<SpaceTimeCell, int>>;
+
+
+class SpaceTimeTest : public ::testing::Test
+{
+protected:
+  // Single-lane corridor with a one-cell alcove next to its right end
+  SpaceTimeTest() : occupancy_{grid::Layout<2>{grid::Coordinates<2>{7, 3}}}, grid_state_space_{occupancy_}
+  {
+    for (std::int32_t x = 0; x < 7; ++x)
+    {
+      occupancy_.set_occupied(grid::Coordinates<2>{x, 0});
+      occupancy_.set_occupied(grid::Coordinates<2>{x, 2}, x != 5);
+    }
+  }
+
+  grid::Cell<2> cell(std::int32_t x, std::int32_t y) const
+  {
+    return occupancy_.layout().state(grid::Coordinates<2>{x, y});
+  }
+
+  static void expect_conflict_free(const std::vector<SpaceTimeCell>& lhs, const std::vector<SpaceTimeCell>& rhs)
+  {
+    // Agents stay at their goals after arriving
+    const auto at = [](const std::vector<SpaceTimeCell>& path, std::size_t time) {
+      return path[std::min(time, path.size() - 1)].state();
+    };
+
+    for (std::size_t t = 0; t < std::max(lhs.size(), rhs.size()); ++t)
+    {
+      EXPECT_FALSE(at(lhs, t) == at(rhs, t)) << "vertex conflict at t=" << t;
+      EXPECT_FALSE(at(lhs, t) == at(rhs, t + 1) and at(lhs, t + 1) == at(rhs, t)) << "edge conflict at t=" << t;
+    }
+  }
+
+  static int path_value(const std::vector<SpaceTimeCell>& path)
+  {
+    grid::StepMetric<2, int> step_metric{{0, 1, 1}};
+    state_space::SpaceTimeMetric<grid::StepMetric<2, int>> metric{step_metric, 1};
+
+    int value = 0;
+    for (std::size_t i = 1; i < path.size(); ++i)
+    {
+      value += metric(path[i - 1], path[i]);
+    }
+    return value;
+  }
+
+  grid::Occupancy<2> occupancy_;
+
+  state_space::Grid<2, 4> grid_state_space_;
+};
+
+
+TEST_F(SpaceTimeTest, ReservationTableReleasePerAgent)
+{
+  state_space::ReservationTable reservations;
+
+  const std::vector<SpaceTimeCell> path_0{{cell(0, 1), 0}, {cell(1, 1), 1}, {cell(2, 1), 2}};
+  const std::vector<SpaceTimeCell> path_1{{cell(6, 1), 0}, {cell(5, 1), 1}};
+  ASSERT_TRUE(reservations.reserve_path(0, path_0.begin(), path_0.end()));
+  ASSERT_TRUE(reservations.reserve_path(1, path_1.begin(), path_1.end()));
+  ASSERT_TRUE(reservations.has_reservations(1));
+  ASSERT_FALSE(reservations.has_reservations(2));
+
+  // Parking on a state another agent is parked on is reported, and reserves nothing
+  ASSERT_FALSE(reservations.park(1, cell(2, 1), 5));
+  ASSERT_EQ(reservations.owner(cell(2, 1), 9), 0U);
+
+  ASSERT_EQ(reservations.owner(cell(1, 1), 1), 0U);
+  ASSERT_EQ(reservations.owner(cell(2, 1), 9), 0U);
+  ASSERT_EQ(reservations.owner(cell(2, 1), 1), state_space::ReservationTable::NO_AGENT);
+  ASSERT_EQ(reservations.owner(cell(5, 1), 4), 1U);
+
+  // Vertex conflict, edge swap conflict, and a free move
+  ASSERT_FALSE(reservations.is_free(cell(3, 1), cell(2, 1), 1));
+  ASSERT_FALSE(reservations.is_free(cell(1, 1), cell(0, 1), 0));
+  ASSERT_TRUE(reservations.is_free(cell(3, 1), cell(4, 1), 1));
+  ASSERT_FALSE(reservations.is_free_after(cell(5, 1), 0, 10));
+  ASSERT_TRUE(reservations.is_free_after(cell(4, 1), 0, 10));
+
+  reservations.release(0);
+  ASSERT_EQ(reservations.owner(cell(1, 1), 1), state_space::ReservationTable::NO_AGENT);
+  ASSERT_EQ(reservations.owner(cell(2, 1), 9), state_space::ReservationTable::NO_AGENT);
+  ASSERT_TRUE(reservations.is_free(cell(1, 1), cell(0, 1), 0));
+  ASSERT_EQ(reservations.owner(cell(5, 1), 4), 1U);
+
+  reservations.release(1);
+  ASSERT_EQ(reservations.size(), 0UL);
+  ASSERT_FALSE(reservations.has_reservations(1));
+}
+
+
+TEST_F(SpaceTimeTest, PrioritizedCorridorSwap)
+{
+  state_space::ReservationTable reservations;
+  state_space::SpaceTime<state_space::Grid<2, 4>> state_space{grid_state_space_, reservations, 32};
+
+  grid::StepMetric<2, int> step_metric{{0, 1, 1}};
+  state_space::SpaceTimeMetric<grid::StepMetric<2, int>> metric{step_metric, 1};
+
+  SpaceTimePlanner planner;
+
+  const std::vector<grid::Cell<2>> starts{cell(0, 1), cell(6, 1)};
+  const std::vector<grid::Cell<2>> goals{cell(6, 1), cell(0, 1)};
+
+  std::vector<std::vector<SpaceTimeCell>> paths;
+  const auto [code, planned] = state_space::plan_prioritized(
+    planner,
+    metric,
+    state_space,
+    reservations,
+    starts.begin(),
+    starts.end(),
+    goals.begin(),
+    std::back_inserter(paths));
+
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(planned, 2UL);
+  ASSERT_EQ(paths.size(), 2UL);
+
+  // Highest priority agent drives straight through; the other agent waits in the alcove
+  ASSERT_EQ(paths[0].size(), 7UL);
+  ASSERT_TRUE(std::any_of(paths[1].begin(), paths[1].end(), [this](const SpaceTimeCell& s) {
+    return s.state() == cell(5, 2);
+  }));
+
+  for (std::size_t agent = 0; agent < 2; ++agent)
+  {
+    ASSERT_EQ(paths[agent].front().state(), starts[agent]);
+    ASSERT_EQ(paths[agent].back().state(), goals[agent]);
+    for (std::size_t i = 0; i < paths[agent].size(); ++i)
+    {
+      ASSERT_EQ(paths[agent][i].time(), i);
+    }
+  }
+
+  expect_conflict_free(paths[0], paths[1]);
+}
+
+
+TEST_F(SpaceTimeTest, PrioritizedAgentIDsAfterExternalReservations)
+{
+  state_space::ReservationTable reservations;
+  state_space::SpaceTime<state_space::Grid<2, 4>> state_space{grid_state_space_, reservations, 32};
+
+  // An agent moving outside of mmpl holds ID 0
+  reservations.reserve(0, cell(3, 1), 1);
+
+  grid::StepMetric<2, int> step_metric{{0, 1, 1}};
+  state_space::SpaceTimeMetric<grid::StepMetric<2, int>> metric{step_metric, 1};
+
+  SpaceTimePlanner planner;
+
+  const std::vector<grid::Cell<2>> starts{cell(0, 1)};
+  const std::vector<grid::Cell<2>> goals{cell(6, 1)};
+
+  std::vector<std::vector<SpaceTimeCell>> paths;
+  const auto [code, planned] = state_space::plan_prioritized(
+    planner,
+    metric,
+    state_space,
+    reservations,
+    starts.begin(),
+    starts.end(),
+    goals.begin(),
+    std::back_inserter(paths),
+    1);
+
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(planned, 1UL);
+  ASSERT_EQ(reservations.owner(cell(6, 1), 20), 1U);
+
+  // Releasing the planned agent leaves the external reservation in place
+  reservations.release(1);
+  ASSERT_EQ(reservations.owner(cell(3, 1), 1), 0U);
+  ASSERT_EQ(reservations.size(), 1UL);
+}
+
+
+TEST_F(SpaceTimeTest, PrioritizedInfeasibleBeforeMaxTime)
+{
+  state_space::ReservationTable reservations;
+  state_space::SpaceTime<state_space::Grid<2, 4>> state_space{grid_state_space_, reservations, 4};
+
+  grid::StepMetric<2, int> step_metric{{0, 1, 1}};
+  state_space::SpaceTimeMetric<grid::StepMetric<2, int>> metric{step_metric, 1};
+
+  SpaceTimePlanner planner;
+
+  const std::vector<grid::Cell<2>> starts{cell(0, 1)};
+  const std::vector<grid::Cell<2>> goals{cell(6, 1)};
+
+  std::vector<std::vector<SpaceTimeCell>> paths;
+  const auto [code, planned] = state_space::plan_prioritized(
+    planner, metric, state_space, reservations, starts.begin(), starts.end(), goals.begin(), std::back_inserter(paths));
+
+  ASSERT_EQ(code, PlannerCode::INFEASIBLE);
+  ASSERT_EQ(planned, 0UL);
+  ASSERT_TRUE(paths.empty());
+}
+
+
+TEST_F(SpaceTimeTest, ConflictBasedSearchResolvesHeadOnSwap)
+{
+  grid::StepMetric<2, int> step_metric{{0, 1, 1}};
+  state_space::SpaceTimeMetric<grid::StepMetric<2, int>> metric{step_metric, 1};
+
+  // Prioritized planning fails in this order: the first agent parks on the second agent's start
+  const std::vector<grid::Cell<2>> starts{cell(6, 1), cell(0, 1)};
+  const std::vector<grid::Cell<2>> goals{cell(0, 1), cell(6, 1)};
+  {
+    state_space::ReservationTable reservations;
+    state_space::SpaceTime<state_space::Grid<2, 4>> state_space{grid_state_space_, reservations, 32};
+    SpaceTimePlanner planner;
+    std::vector<std::vector<SpaceTimeCell>> paths;
+    ASSERT_EQ(
+      state_space::plan_prioritized(
+        planner,
+        metric,
+        state_space,
+        reservations,
+        starts.begin(),
+        starts.end(),
+        goals.begin(),
+        std::back_inserter(paths))
+        .first,
+      PlannerCode::INFEASIBLE);
+  }
+
+  planner::ConflictBasedSearch<SpaceTimePlanner> cbs{32, 256};
+  const auto [code, iterations] = cbs.run(metric, grid_state_space_, starts.begin(), starts.end(), goals.begin());
+  ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+  ASSERT_EQ(cbs.agent_count(), 2UL);
+
+  // One agent drives straight through (6) while the other waits in the alcove (11)
+  ASSERT_EQ(cbs.value(), 17);
+  ASSERT_EQ(path_value(cbs.path(0)) + path_value(cbs.path(1)), cbs.value());
+
+  for (std::size_t agent = 0; agent < 2; ++agent)
+  {
+    ASSERT_EQ(cbs.path(agent).front(), SpaceTimeCell(starts[agent], 0));
+    ASSERT_EQ(cbs.path(agent).back().state(), goals[agent]);
+  }
+  expect_conflict_free(cbs.path(0), cbs.path(1));
+}
+
+
+TEST(ConflictBasedSearch, IncrementalMatchesFreshLowLevelSearches)
+{
+  std::mt19937 rng{17};
+  std::size_t solved = 0;
+  std::size_t incremental_iterations = 0;
+  std::size_t fresh_iterations = 0;
+  for (int trial = 0; trial < 600; ++trial)
+  {
+    // Small cluttered grids force agents to wait and detour around each other, often at their goals
+    const grid::Coordinates<2> extents{
+      static_cast<std::int32_t>(4 + rng() % 3), static_cast<std::int32_t>(3 + rng() % 3)};
+    grid::Occupancy<2> occupancy{grid::Layout<2>{extents}};
+    std::vector<grid::Cell<2>> free_cells;
+    for (std::int32_t y = 0; y < extents[1]; ++y)
+    {
+      for (std::int32_t x = 0; x < extents[0]; ++x)
+      {
+        if (rng() % 6 == 0)
+        {
+          occupancy.set_occupied(grid::Coordinates<2>{x, y});
+        }
+        else
+        {
+          free_cells.push_back(occupancy.layout().state(grid::Coordinates<2>{x, y}));
+        }
+      }
+    }
+
+    const std::size_t agent_count = 2 + rng() % 2;
+    if (free_cells.size() < agent_count)
+    {
+      continue;
+    }
+    std::shuffle(free_cells.begin(), free_cells.end(), rng);
+    const std::vector<grid::Cell<2>> starts{free_cells.begin(), free_cells.begin() + agent_count};
+    std::shuffle(free_cells.begin(), free_cells.end(), rng);
+    const std::vector<grid::Cell<2>> goals{free_cells.begin(), free_cells.begin() + agent_count};
+
+    TestRandomStepMetric metric{rng()};
+    state_space::Grid<2, 4> grid_state_space{occupancy};
+    planner::ConflictBasedSearch<SpaceTimePlanner> cbs{12, 2048};
+    planner::ConflictBasedSearch<SpaceTimePlanner> fresh{12, 2048};
+    fresh.set_incremental(false);
+    const auto [code, iterations] = cbs.run(metric, grid_state_space, starts.begin(), starts.end(), goals.begin());
+    const auto [fresh_code, fresh_nodes] =
+      fresh.run(metric, grid_state_space, starts.begin(), starts.end(), goals.begin());
+
+    // Without ties, low-level searches returning the same values make the same constraint tree
+    ASSERT_EQ(code == PlannerCode::GOAL_FOUND, fresh_code == PlannerCode::GOAL_FOUND) << "trial " << trial;
+    ASSERT_EQ(iterations, fresh_nodes) << "trial " << trial;
+    ASSERT_EQ(cbs.low_level_searches(), fresh.low_level_searches()) << "trial " << trial;
+    if (code == PlannerCode::GOAL_FOUND)
+    {
+      ASSERT_EQ(cbs.value(), fresh.value()) << "trial " << trial;
+      ++solved;
+    }
+    incremental_iterations += cbs.low_level_iterations();
+    fresh_iterations += fresh.low_level_iterations();
+  }
+  ASSERT_GT(solved, 100UL);
+  ASSERT_LT(incremental_iterations, fresh_iterations);
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,129 @@
+
+#ifndef MMPL_ENABLE_TRACE
+#define MMPL_ENABLE_TRACE
+#endif  // MMPL_ENABLE_TRACE
+
+// C++ Standard Library
+#include <atomic>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// MMPL
+#include <mmpl/expansion_queue/min_sorted.h>
+#include <mmpl/expansion_table/unordered.h>
+#include <mmpl/planner.h>
+#include <mmpl/state_space/csr.h>
+#include <mmpl/trace.h>
+
+using namespace mmpl;
+using namespace mmpl::state_space;
+
+
+class TraceTest : public ::testing::Test
+{
+protected:
+  using PlannerType = ShortestPathPlanner<
+    CsrVertex,
+    int,
+    expansion_queue::MinSorted<CsrVertex, int>,
+    expansion_table::Unordered<CsrVertex, int>>;
+
+  // 0 --10--> 1 --1--> 3
+  // 0 --1---> 2 --1--> 1
+  TraceTest() :
+      edges_{CsrEdge<int>{1, 3, 1}, CsrEdge<int>{0, 1, 10}, CsrEdge<int>{2, 1, 1}, CsrEdge<int>{0, 2, 1}},
+      graph_{4, edges_.begin(), edges_.end()}
+  {
+    trace::clear();
+  }
+
+  void plan()
+  {
+    PlannerType planner;
+    CsrStateSpace<int> state_space{graph_};
+    CsrMetric<int> metric{graph_};
+
+    const auto [code, iterations] = run_plan(planner, metric, state_space, CsrVertex{0}, CsrVertex{3});
+    ASSERT_EQ(code, PlannerCode::GOAL_FOUND);
+
+    std::vector<CsrVertex> path;
+    generate_reverse_path(std::back_inserter(path), CsrVertex{3}, planner.expansion_table());
+    ASSERT_EQ(path.size(), 4UL);
+  }
+
+  std::vector<CsrEdge<int>> edges_;
+
+  CsrGraph<int> graph_;
+};
+
+
+TEST_F(TraceTest, RecordsPlannerPhases)
+{
+  plan();
+  ASSERT_GT(trace::event_count(), 0UL);
+  ASSERT_EQ(trace::dropped_count(), 0UL);
+
+  std::ostringstream os;
+  trace::write_chrome_trace(os);
+
+  const std::string json = os.str();
+  ASSERT_EQ(json.rfind("{\"traceEvents\":[", 0), 0UL);
+  for (const char* name :
+       {"run_plan", "queue_pop", "queue_push", "child_generation", "metric", "table_lookup", "path_extraction"})
+  {
+    ASSERT_NE(json.find(std::string{"\"name\":\""} + name + '"'), std::string::npos) << name;
+  }
+
+  trace::clear();
+  ASSERT_EQ(trace::event_count(), 0UL);
+}
+
+
+TEST_F(TraceTest, KeepsEventsOfFinishedThreads)
+{
+  static constexpr std::size_t kThreadCount = 4;
+
+  // Hold all threads until each has recorded, so that none reuses the buffer of another
+  std::atomic<std::size_t> arrived{0};
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kThreadCount; ++i)
+  {
+    threads.emplace_back([this, &arrived] {
+      plan();
+      ++arrived;
+      while (arrived.load() < kThreadCount)
+      {
+        std::this_thread::yield();
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::ostringstream os;
+  trace::write_chrome_trace(os);
+
+  std::set<std::string> thread_ids;
+  const std::string json = os.str();
+  for (auto pos = json.find("\"tid\":"); pos != std::string::npos; pos = json.find("\"tid\":", pos + 1))
+  {
+    thread_ids.insert(json.substr(pos, json.find('}', pos) - pos));
+  }
+  ASSERT_EQ(thread_ids.size(), kThreadCount);
+}
+
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}